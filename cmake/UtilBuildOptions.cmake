@@ -0,0 +1,99 @@
+# Build options shared by the threads and opengl libraries. Included by the top level CMakeLists.txt and by each library's
+# CMakeLists.txt, so the libraries can also be configured on their own.
+
+include_guard(GLOBAL)
+
+set(CMAKE_CXX_STANDARD 20)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+if (NOT CMAKE_BUILD_TYPE AND NOT CMAKE_CONFIGURATION_TYPES)
+	set(CMAKE_BUILD_TYPE Release CACHE STRING "Build type" FORCE)
+endif()
+
+option(UTIL_BUILD_SHARED "Build shared libraries in addition to the static ones" ON)
+option(UTIL_NATIVE "Compile for the build machine's CPU (-march=native)" OFF)
+option(UTIL_LTO "Enable link time optimization" OFF)
+set(UTIL_PGO "OFF" CACHE STRING "Profile guided optimization stage, OFF, GENERATE or USE")
+set_property(CACHE UTIL_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(UTIL_PGO_DIR "${CMAKE_BINARY_DIR}/pgo-profile" CACHE PATH "Directory for PGO profile data")
+set(UTIL_SANITIZE "" CACHE STRING "Sanitizers to enable, e.g. address,undefined or thread")
+
+if (UTIL_LTO)
+	include(CheckIPOSupported)
+	check_ipo_supported(RESULT UTIL_LTO_SUPPORTED OUTPUT UTIL_LTO_ERROR LANGUAGES CXX)
+	if (NOT UTIL_LTO_SUPPORTED)
+		message(WARNING "LTO requested but not supported: ${UTIL_LTO_ERROR}")
+	endif()
+endif()
+
+if (NOT UTIL_PGO STREQUAL "OFF" AND NOT UTIL_PGO STREQUAL "GENERATE" AND NOT UTIL_PGO STREQUAL "USE")
+	message(FATAL_ERROR "UTIL_PGO must be OFF, GENERATE or USE, not ${UTIL_PGO}")
+endif()
+
+# Applies the options above to a library or executable target
+function(util_configure_target target)
+	if (UTIL_NATIVE AND NOT MSVC)
+		target_compile_options(${target} PRIVATE -march=native)
+	endif()
+
+	if (UTIL_LTO AND UTIL_LTO_SUPPORTED)
+		set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+	endif()
+
+	if (UTIL_PGO STREQUAL "GENERATE")
+		if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+			target_compile_options(${target} PRIVATE -fprofile-instr-generate=${UTIL_PGO_DIR}/%p.profraw)
+			target_link_options(${target} PRIVATE -fprofile-instr-generate)
+		else()
+			target_compile_options(${target} PRIVATE -fprofile-generate=${UTIL_PGO_DIR} -fprofile-update=atomic)
+			target_link_options(${target} PRIVATE -fprofile-generate=${UTIL_PGO_DIR})
+		endif()
+	elseif (UTIL_PGO STREQUAL "USE")
+		if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+			target_compile_options(${target} PRIVATE -fprofile-instr-use=${UTIL_PGO_DIR}/default.profdata -Wno-profile-instr-unprofiled)
+			target_link_options(${target} PRIVATE -fprofile-instr-use=${UTIL_PGO_DIR}/default.profdata)
+		else()
+			target_compile_options(${target} PRIVATE -fprofile-use=${UTIL_PGO_DIR} -fprofile-partial-training -Wno-missing-profile)
+			target_link_options(${target} PRIVATE -fprofile-use=${UTIL_PGO_DIR})
+		endif()
+	endif()
+
+	if (UTIL_SANITIZE AND NOT MSVC)
+		target_compile_options(${target} PRIVATE -fsanitize=${UTIL_SANITIZE} -fno-omit-frame-pointer)
+		target_link_options(${target} PRIVATE -fsanitize=${UTIL_SANITIZE})
+	endif()
+endfunction()
+
+# Builds NAME_static, and NAME_shared if UTIL_BUILD_SHARED is on, from one set of objects. Both produce libNAME.
+# NAME is an alias of the static library.
+function(util_add_library name)
+	set(objects ${name}_objects)
+	add_library(${objects} OBJECT ${ARGN})
+	set_property(TARGET ${objects} PROPERTY POSITION_INDEPENDENT_CODE ON)
+	util_configure_target(${objects})
+
+	add_library(${name}_static STATIC $<TARGET_OBJECTS:${objects}>)
+	set_property(TARGET ${name}_static PROPERTY OUTPUT_NAME ${name})
+	util_configure_target(${name}_static)
+	add_library(${name} ALIAS ${name}_static)
+
+	if (UTIL_BUILD_SHARED)
+		add_library(${name}_shared SHARED $<TARGET_OBJECTS:${objects}>)
+		set_target_properties(${name}_shared PROPERTIES
+			OUTPUT_NAME ${name}
+			WINDOWS_EXPORT_ALL_SYMBOLS ON)
+		util_configure_target(${name}_shared)
+	endif()
+endfunction()
+
+# Adds include directories, link libraries and compile definitions to the object, static and shared targets made by util_add_library
+function(util_library_interface name)
+	cmake_parse_arguments(ARG "" "" "INCLUDES;LIBS;DEFINES" ${ARGN})
+	foreach (target ${name}_objects ${name}_static ${name}_shared)
+		if (TARGET ${target})
+			target_include_directories(${target} PUBLIC ${ARG_INCLUDES})
+			target_link_libraries(${target} PUBLIC ${ARG_LIBS})
+			target_compile_definitions(${target} PUBLIC ${ARG_DEFINES})
+		endif()
+	endforeach()
+endfunction()
@@ -0,0 +1,904 @@
+/*
+    Replay benchmark for MultiVboHandler under an offscreen EGL context. Intended for Mesa llvmpipe so it runs on a plain
+    Linux box, but any EGL driver with desktop GL works.
+
+    ogl_bench [--quick] [--reps N] [--filter text] [--format json|csv] [--out file]
+
+    A synthetic model of grid patch faces is tessellated into the handler, its element indices are set and it's drawn
+    into an offscreen framebuffer. Output format matches threads_bench, times are nanoseconds per operation.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <OGLExtensions.h>
+#include <OGLShader.h>
+#include <OGLMultiVboHandler.h>
+#include <OGLMultiVboHandlerTempl.h>
+#include <OGLParameterBlock.h>
+#include <OGLStreamBuffer.h>
+
+using namespace std;
+using namespace OGL;
+
+namespace {
+
+struct Options {
+    bool _quick = false;
+    size_t _reps = 5;
+    string _filter;
+    string _format = "json";
+    string _outPath;
+};
+
+struct Result {
+    string _suite, _name, _variant;
+    size_t _ops;
+    double _nsPerOp, _minNsPerOp;
+};
+
+Options g_options;
+vector<Result> g_results;
+string g_renderer;
+
+bool isSelected(const string& suite, const string& name, const string& variant)
+{
+    if (g_options._filter.empty())
+        return true;
+
+    string fullName = suite + "/" + name + "/" + variant;
+    return fullName.find(g_options._filter) != string::npos;
+}
+
+/*
+    Runs f once to warm up, then _reps times. f performs ops operations. setup, if given, runs untimed before each call.
+    f must finish its GL work (glFinish) so the time includes the driver.
+*/
+void measure(const string& suite, const string& name, const string& variant, size_t ops,
+    const function<void()>& f, const function<void()>& setup = nullptr)
+{
+    if (!isSelected(suite, name, variant))
+        return;
+
+    using Clock = chrono::steady_clock;
+
+    vector<double> samples;
+    for (size_t rep = 0; rep <= g_options._reps; rep++) {
+        if (setup)
+            setup();
+
+        auto start = Clock::now();
+        f();
+        auto stop = Clock::now();
+
+        if (rep > 0)
+            samples.push_back(chrono::duration<double, nano>(stop - start).count() / ops);
+    }
+
+    sort(samples.begin(), samples.end());
+    Result res = { suite, name, variant, ops, samples[samples.size() / 2], samples.front() };
+    g_results.push_back(res);
+
+    fprintf(stderr, "%-12s %-24s %-16s %14.1f ns/op\n", suite.c_str(), name.c_str(), variant.c_str(), res._nsPerOp);
+}
+
+class OffscreenContext {
+public:
+    ~OffscreenContext();
+
+    bool create(int width, int height);
+
+private:
+    EGLDisplay _display = EGL_NO_DISPLAY;
+    EGLContext _context = EGL_NO_CONTEXT;
+    GLuint _fbo = 0, _colorRb = 0, _depthRb = 0;
+};
+
+OffscreenContext::~OffscreenContext()
+{
+    if (_fbo) {
+        glDeleteFramebuffers(1, &_fbo);
+        glDeleteRenderbuffers(1, &_colorRb);
+        glDeleteRenderbuffers(1, &_depthRb);
+    }
+
+    if (_display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (_context != EGL_NO_CONTEXT)
+            eglDestroyContext(_display, _context);
+        eglTerminate(_display);
+    }
+}
+
+bool OffscreenContext::create(int width, int height)
+{
+    // Surfaceless needs no window system, fall back to the default display if the driver doesn't have it
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay)
+        _display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    if (_display == EGL_NO_DISPLAY)
+        _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    EGLint major, minor;
+    if (_display == EGL_NO_DISPLAY || !eglInitialize(_display, &major, &minor) || !eglBindAPI(EGL_OPENGL_API))
+        return false;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(_display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+        return false;
+
+    // MultiVBO still uses the attribute stacks, so it needs a compatibility profile
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 5,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+#if OGL_GL_ERROR_CHECK == 1
+        EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE, // Lets GL_ASSERT use the KHR_debug callback instead of glGetError
+#endif
+        EGL_NONE
+    };
+    _context = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (_context == EGL_NO_CONTEXT || !eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, _context))
+        return false;
+
+    glGenRenderbuffers(1, &_colorRb);
+    glBindRenderbuffer(GL_RENDERBUFFER, _colorRb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    glGenRenderbuffers(1, &_depthRb);
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthRb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+
+    glGenFramebuffers(1, &_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, _fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _colorRb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _depthRb);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        return false;
+
+    glViewport(0, 0, width, height);
+    glEnable(GL_DEPTH_TEST);
+
+    const char* pRenderer = (const char*)glGetString(GL_RENDERER);
+    g_renderer = pRenderer ? pRenderer : "unknown";
+
+    return true;
+}
+
+const char* s_vertexSrc = R"(
+#version 120
+attribute vec3 inPosition;
+attribute vec3 inNormal;
+varying vec3 vNormal;
+void main()
+{
+    vNormal = gl_NormalMatrix * inNormal;
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(inPosition, 1.0);
+}
+)";
+
+const char* s_fragmentSrc = R"(
+#version 120
+varying vec3 vNormal;
+void main()
+{
+    float d = max(dot(normalize(vNormal), vec3(0.0, 0.0, 1.0)), 0.2);
+    gl_FragColor = vec4(d, d, d, 1.0);
+}
+)";
+
+// Per material values for the shader switching benchmark
+const char* s_materialVertexSrc = R"(
+#version 120
+attribute vec3 inPosition;
+attribute vec3 inNormal;
+uniform mat4 modelMatrix;
+uniform vec4 baseColor;
+uniform float ambient, diffuse, specular, shininess, opacity, highlight;
+varying vec4 vColor;
+void main()
+{
+    float d = max(dot(normalize(gl_NormalMatrix * inNormal), vec3(0.0, 0.0, 1.0)), 0.0);
+    float s = specular * pow(d, shininess) + highlight;
+    vColor = vec4(baseColor.rgb * (ambient + diffuse * d) + vec3(s), baseColor.a * opacity);
+    gl_Position = gl_ModelViewProjectionMatrix * modelMatrix * vec4(inPosition, 1.0);
+}
+)";
+
+const char* s_materialFragmentSrc = R"(
+#version 120
+varying vec4 vColor;
+void main()
+{
+    gl_FragColor = vColor;
+}
+)";
+
+// Camera and lights for the shared parameter benchmark, as plain uniforms or in a uniform block like phong.vert's
+const char* s_sharedParamsSrc = R"(
+uniform mat4 modelView;
+uniform mat4 proj;
+uniform int numLights;
+uniform vec3 lightDir[8];
+)";
+
+const char* s_sharedBlockSrc = R"(
+uniform UniformBufferObject {
+    mat4 modelView;
+    mat4 proj;
+    int numLights;
+    vec3 lightDir[8];
+};
+)";
+
+// Each program scales the lighting differently, so they're distinct programs
+const char* s_sharedVertexSrc = R"(
+in vec3 inPosition;
+in vec3 inNormal;
+out vec4 vColor;
+void main()
+{
+    vec3 normal = normalize((modelView * vec4(inNormal, 0.0)).xyz);
+    float intensity = 0.0;
+    for (int i = 0; i < numLights; i++)
+        intensity += max(dot(lightDir[i], normal), 0.0);
+    vColor = vec4(vec3(min(intensity * SCALE, 1.0)), 1.0);
+    gl_Position = proj * modelView * vec4(inPosition, 1.0);
+}
+)";
+
+const char* s_sharedFragmentSrc = R"(
+#version 330
+in vec4 vColor;
+out vec4 outColor;
+void main()
+{
+    outColor = vColor;
+}
+)";
+
+// One face's tessellation, a gridSize x gridSize patch of vertices
+struct FaceTess {
+    vector<float> _points, _normals, _parameters;
+    vector<unsigned int> _indices;
+};
+
+/*
+    Faces are laid out on a square grid in [-1, 1], with a little curvature so normals vary
+*/
+struct Model {
+    Model(size_t numFaces, size_t gridSize, int numKeys);
+
+    void makeFace(size_t faceIdx, size_t changeNumber, FaceTess& tess) const;
+    int keyOf(size_t faceIdx) const;
+
+    const size_t _numFaces, _gridSize;
+    const int _numKeys;
+    size_t _facesPerRow;
+};
+
+Model::Model(size_t numFaces, size_t gridSize, int numKeys)
+    : _numFaces(numFaces)
+    , _gridSize(gridSize)
+    , _numKeys(numKeys)
+{
+    _facesPerRow = 1;
+    while (_facesPerRow * _facesPerRow < numFaces)
+        _facesPerRow++;
+}
+
+void Model::makeFace(size_t faceIdx, size_t changeNumber, FaceTess& tess) const
+{
+    tess._points.clear();
+    tess._normals.clear();
+    tess._parameters.clear();
+    tess._indices.clear();
+
+    float faceSize = 2.0f / _facesPerRow;
+    float x0 = -1.0f + (faceIdx % _facesPerRow) * faceSize;
+    float y0 = -1.0f + (faceIdx / _facesPerRow) * faceSize;
+    float bulge = 0.05f * (1 + changeNumber % 3);
+
+    for (size_t j = 0; j < _gridSize; j++) {
+        for (size_t i = 0; i < _gridSize; i++) {
+            float u = i / (float)(_gridSize - 1);
+            float v = j / (float)(_gridSize - 1);
+            float z = bulge * u * (1 - u) * v * (1 - v);
+
+            tess._points.insert(tess._points.end(), { x0 + u * faceSize, y0 + v * faceSize, z });
+            tess._normals.insert(tess._normals.end(), { (2 * u - 1) * bulge, (2 * v - 1) * bulge, 1.0f });
+            tess._parameters.insert(tess._parameters.end(), { u, v });
+        }
+    }
+
+    for (size_t j = 0; j + 1 < _gridSize; j++) {
+        for (size_t i = 0; i + 1 < _gridSize; i++) {
+            unsigned int i0 = (unsigned int)(j * _gridSize + i);
+            unsigned int i1 = i0 + 1;
+            unsigned int i2 = i0 + (unsigned int)_gridSize;
+            unsigned int i3 = i2 + 1;
+            tess._indices.insert(tess._indices.end(), { i0, i1, i3, i0, i3, i2 });
+        }
+    }
+}
+
+int Model::keyOf(size_t faceIdx) const
+{
+    return (int)(faceIdx % _numKeys);
+}
+
+void tessellateAll(MultiVboHandler& handler, const Model& model, vector<IndicesPtr>& faceIndices)
+{
+    FaceTess tess;
+    faceIndices.resize(model._numFaces);
+
+    handler.beginFaceTesselation();
+    for (size_t faceIdx = 0; faceIdx < model._numFaces; faceIdx++) {
+        model.makeFace(faceIdx, 0, tess);
+        faceIndices[faceIdx] = handler.setFaceTessellation(faceIdx, 0, tess._points, tess._normals, tess._parameters, tess._indices);
+    }
+    handler.endFaceTesselation(true);
+}
+
+void setAllElementIndices(MultiVboHandler& handler, const Model& model, const vector<IndicesPtr>& faceIndices)
+{
+    handler.beginSettingElementIndices(_SIZE_T_ERROR);
+    for (size_t faceIdx = 0; faceIdx < model._numFaces; faceIdx++)
+        handler.includeElementIndices(model.keyOf(faceIdx), faceIndices[faceIdx]);
+    handler.endSettingElementIndices();
+}
+
+// checkErrors calls glGetError after each key's draw, the way GL_ASSERT does when error checking is compiled in
+void drawFrame(MultiVboHandler& handler, Shader& shader, bool checkErrors = false)
+{
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    shader.bind();
+    handler.drawAllKeys(
+        [](int) { return MultiVBO::DRAW_COLOR_NONE; },
+        [checkErrors]() {
+            if (checkErrors)
+                glGetError();
+        },
+        [](GLuint) {},
+        []() {});
+    shader.unBind();
+}
+
+void drawFrameIndirect(MultiVboHandler& handler, Shader& shader)
+{
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    shader.bind();
+    handler.drawAllKeysIndirect();
+    shader.unBind();
+}
+
+/*
+    Many keys, each a couple of triangles, drawn into a one pixel viewport. Nearly all the time is the CPU side of binding batches and
+    issuing draws. An op is one draw call. The _indirect variant submits each batch's keys with one multi draw indirect call and
+    _get_error adds one glGetError per draw. The library's own GL_ASSERT checking is set at build time by OGL_GL_ERROR_CHECK.
+*/
+void benchDrawCalls(Shader& shader, const string& layoutName, const VertexLayout& layout)
+{
+    const int numKeys = 1024;
+    Model model(4 * numKeys, 2, numKeys);
+    vector<IndicesPtr> faceIndices;
+
+    MultiVboHandler handler(GL_TRIANGLES, numKeys);
+    handler.setShader(&shader);
+    handler.setVertexLayout(layout);
+    tessellateAll(handler, model, faceIndices);
+    setAllElementIndices(handler, model, faceIndices);
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glViewport(0, 0, 1, 1);
+
+    size_t numFrames = g_options._quick ? 10 : 100;
+    measure("multi_vbo", "draw_calls", layoutName, numFrames * numKeys, [&]() {
+        for (size_t i = 0; i < numFrames; i++)
+            drawFrame(handler, shader);
+        glFinish();
+    });
+
+    measure("multi_vbo", "draw_calls", layoutName + "_get_error", numFrames * numKeys, [&]() {
+        for (size_t i = 0; i < numFrames; i++)
+            drawFrame(handler, shader, true);
+        glFinish();
+    });
+
+    measure("multi_vbo", "draw_calls", layoutName + "_indirect", numFrames * numKeys, [&]() {
+        for (size_t i = 0; i < numFrames; i++)
+            drawFrameIndirect(handler, shader);
+        glFinish();
+    });
+
+    if (isSelected("multi_vbo", "draw_calls", layoutName)) {
+        Extensions::GLState::resetCounters();
+        drawFrame(handler, shader);
+        const auto& counters = Extensions::GLState::getCounters();
+        fprintf(stderr, "%s state calls per draw: issued %.2f, filtered %.2f, queries %zu\n", layoutName.c_str(),
+            (double)counters.m_issued / numKeys, (double)counters.m_filtered / numKeys, counters.m_queries);
+    }
+
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    handler.clear();
+}
+
+void benchMultiVboHandler()
+{
+    const string suite = "multi_vbo";
+
+    Shader shader;
+    shader.setVertexSrc(s_vertexSrc);
+    shader.setFragmentSrc(s_fragmentSrc);
+    shader.setShaderVertexAttribName("inPosition");
+    shader.setShaderNormalAttribName("inNormal");
+    shader.bind();
+    shader.unBind();
+
+    const int numKeys = 8;
+    Model model(g_options._quick ? 256 : 2048, 16, numKeys);
+    vector<IndicesPtr> faceIndices;
+
+    // Separate buffers per attribute against everything in one buffer, position, normal and texture coordinate per vertex.
+    // compact is interleaved with packed normals and half float texture coordinates, 20 bytes per vertex instead of 32.
+    const pair<string, VertexLayout> layouts[] = {
+        { "separate", VertexLayout() },
+        { "interleaved", VertexLayout::packed(true, true, false) },
+        { "compact", VertexLayout::compact(true, true, false) },
+    };
+    for (const auto& layoutPair : layouts) {
+        const string& layoutName = layoutPair.first;
+        const VertexLayout& layout = layoutPair.second;
+        faceIndices.clear();
+        MultiVboHandler handler(GL_TRIANGLES, numKeys);
+        handler.setShader(&shader);
+        handler.setVertexLayout(layout);
+
+        measure(suite, "tessellate_upload", layoutName, model._numFaces, [&]() {
+            tessellateAll(handler, model, faceIndices);
+            glFinish();
+        }, [&]() {
+            handler.clear();
+        });
+
+        // The rest need the model loaded, even if the filter skipped the scenarios which load it
+        if (handler.empty())
+            tessellateAll(handler, model, faceIndices);
+
+        measure(suite, "set_element_indices", layoutName, model._numFaces, [&]() {
+            setAllElementIndices(handler, model, faceIndices);
+            glFinish();
+        });
+        setAllElementIndices(handler, model, faceIndices);
+
+        size_t numFrames = g_options._quick ? 5 : 30;
+        measure(suite, "draw_frame", layoutName, numFrames, [&]() {
+            for (size_t i = 0; i < numFrames; i++)
+                drawFrame(handler, shader);
+            glFinish();
+        });
+
+        measure(suite, "draw_frame", layoutName + "_indirect", numFrames, [&]() {
+            for (size_t i = 0; i < numFrames; i++)
+                drawFrameIndirect(handler, shader);
+            glFinish();
+        });
+
+        // Same frames through draw(key), one pass over the batches per key
+        measure(suite, "draw_by_key", layoutName, numFrames, [&]() {
+            for (size_t i = 0; i < numFrames; i++) {
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                shader.bind();
+                for (int key = 0; key < numKeys; key++)
+                    handler.draw(key);
+                shader.unBind();
+            }
+            glFinish();
+        });
+
+        // Interactive editing, one face re-tessellated per begin/end. Only the changed vertices should go to the card.
+        // The faces' old tessellations are released, untimed, so the edits reuse their space. doGarbageCollection releases the entities it's given.
+        size_t numEdits = min<size_t>(g_options._quick ? 20 : 200, model._numFaces);
+        size_t changeNumber = 0, editPass = 0;
+        FaceTess tess;
+        auto editedFace = [&](size_t i) { return (editPass * numEdits + i) * 7919 % model._numFaces; };
+
+        StreamBuffer streamBuffer;
+        for (bool streaming : { false, true }) {
+            handler.setStreamBuffer(streaming ? &streamBuffer : nullptr);
+
+            measure(suite, "edit_face", streaming ? layoutName + "_stream" : layoutName, numEdits, [&]() {
+                for (size_t i = 0; i < numEdits; i++) {
+                    size_t faceIdx = editedFace(i);
+                    model.makeFace(faceIdx, changeNumber, tess);
+
+                    handler.beginFaceTesselation();
+                    faceIndices[faceIdx] = handler.setFaceTessellation(faceIdx, changeNumber, tess._points, tess._normals, tess._parameters, tess._indices);
+                    handler.endFaceTesselation(true);
+                }
+                glFinish();
+            }, [&]() {
+                editPass++;
+                changeNumber++;
+
+                vector<MultiVboHandler::ChangeRec> toRelease;
+                for (size_t i = 0; i < numEdits; i++) {
+                    size_t faceIdx = editedFace(i);
+                    toRelease.push_back(MultiVboHandler::ChangeRec(faceIdx, handler.getOglIndices(faceIdx)->m_changeNumber));
+                }
+                handler.doGarbageCollection(toRelease);
+            });
+            streamBuffer.nextRegion();
+        }
+        handler.setStreamBuffer(nullptr);
+
+        handler.clear();
+
+        benchDrawCalls(shader, layoutName, layout);
+    }
+}
+
+/*
+    Upload throughput into an existing vertex buffer, in 64 KB blocks. A frame is 16 blocks written to successive offsets, then drawn from.
+    buffer_data reallocates each block's VBO like the original copyToVBO path, buffer_sub_data updates in place and persistent_ring
+    writes into a persistently mapped StreamBuffer and has the GPU copy it.
+*/
+void benchStreaming()
+{
+    const string suite = "stream";
+    const size_t blockBytes = 64 * 1024, blocksPerFrame = 16, numBlockVbos = 64;
+    const size_t numFrames = g_options._quick ? 20 : 200;
+    const size_t numBlocks = numFrames * blocksPerFrame;
+
+    vector<float> src(blockBytes / sizeof(float));
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (float)(i % 1000) * 0.001f;
+
+    GLuint dstVbo;
+    glGenBuffers(1, &dstVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, dstVbo);
+    glBufferData(GL_ARRAY_BUFFER, numBlockVbos * blockBytes, nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    vector<GLuint> blockVbos(numBlockVbos);
+    glGenBuffers((GLsizei)numBlockVbos, blockVbos.data());
+
+    // Reading the block makes the next write to it wait on the GPU, the way drawing a batch does
+    auto drawFrom = [](GLuint vbo, size_t offset) {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(3, GL_FLOAT, 0, (const void*)offset);
+        glDrawArrays(GL_POINTS, 0, 64);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    };
+
+    measure(suite, "upload_64k", "buffer_data", numBlocks, [&]() {
+        for (size_t i = 0; i < numBlocks; i++) {
+            GLuint vbo = blockVbos[i % numBlockVbos];
+            glBindBuffer(GL_ARRAY_BUFFER, vbo);
+            glBufferData(GL_ARRAY_BUFFER, blockBytes, src.data(), GL_STATIC_DRAW);
+            if (i % blocksPerFrame == blocksPerFrame - 1)
+                drawFrom(vbo, 0);
+        }
+        glFinish();
+    });
+
+    measure(suite, "upload_64k", "buffer_sub_data", numBlocks, [&]() {
+        for (size_t i = 0; i < numBlocks; i++) {
+            size_t dstOffset = (i % numBlockVbos) * blockBytes;
+            glBindBuffer(GL_ARRAY_BUFFER, dstVbo);
+            glBufferSubData(GL_ARRAY_BUFFER, dstOffset, blockBytes, src.data());
+            if (i % blocksPerFrame == blocksPerFrame - 1)
+                drawFrom(dstVbo, dstOffset);
+        }
+        glFinish();
+    });
+
+    StreamBuffer streamBuffer(blocksPerFrame * blockBytes);
+    if (!streamBuffer.isPersistent())
+        fprintf(stderr, "No buffer storage support, persistent_ring falls back to glBufferSubData\n");
+
+    measure(suite, "upload_64k", "persistent_ring", numBlocks, [&]() {
+        for (size_t i = 0; i < numBlocks; i++) {
+            size_t dstOffset = (i % numBlockVbos) * blockBytes;
+            size_t offset;
+            void* pDst = streamBuffer.alloc(blockBytes, offset);
+            memcpy(pDst, src.data(), blockBytes);
+            streamBuffer.copyTo(dstVbo, dstOffset, offset, blockBytes);
+            if (i % blocksPerFrame == blocksPerFrame - 1) {
+                drawFrom(dstVbo, dstOffset);
+                streamBuffer.nextRegion();
+            }
+        }
+        glFinish();
+    });
+    fprintf(stderr, "persistent_ring stalls: %zu\n", streamBuffer.numStalls());
+
+    glDeleteBuffers((GLsizei)numBlockVbos, blockVbos.data());
+    glDeleteBuffers(1, &dstVbo);
+
+    // The raw GL calls above bypass the library's state shadow
+    Extensions::GLState::invalidate();
+}
+
+const char* glErrorCheckName()
+{
+#if OGL_GL_ERROR_CHECK == 1
+    return "on";
+#elif OGL_GL_ERROR_CHECK == 2
+    return "sampled";
+#else
+    return "off";
+#endif
+}
+
+/*
+    CPU cost of switching between two material shaders. Each switch binds a shader and sets its 8 uniforms, only the
+    highlight changes from one switch to the next. by_name looks each uniform up by name, by_handle uses the handles
+    returned by the first set. Nothing is drawn, the time is the bind and uniform traffic.
+*/
+void benchShaderUniforms()
+{
+    const string suite = "shader";
+    const size_t numSwitches = g_options._quick ? 2000 : 20000;
+    const char* floatNames[] = { "ambient", "diffuse", "specular", "shininess", "opacity", "highlight" };
+    const float floatValues[] = { 0.2f, 0.7f, 0.5f, 16.0f, 1.0f, 0.0f };
+    const size_t highlightIdx = 5;
+
+    struct Material {
+        Shader _shader;
+        col4f _color;
+        m44f _modelMatrix;
+        ShaderBase::UniformHandle _colorHandle, _matrixHandle, _floatHandles[6];
+    };
+
+    Material materials[2];
+    materials[0]._color = col4f(0.8f, 0.2f, 0.2f, 1.0f);
+    materials[1]._color = col4f(0.2f, 0.2f, 0.8f, 1.0f);
+    for (auto& material : materials) {
+        Shader& shader = material._shader;
+        shader.setVertexSrc(s_materialVertexSrc);
+        shader.setFragmentSrc(s_materialFragmentSrc);
+        shader.setShaderVertexAttribName("inPosition");
+        shader.setShaderNormalAttribName("inNormal");
+
+        material._colorHandle = shader.setVariable("baseColor", material._color);
+        material._matrixHandle = shader.setVariable("modelMatrix", material._modelMatrix);
+        for (size_t i = 0; i < 6; i++)
+            material._floatHandles[i] = shader.setVariable(floatNames[i], floatValues[i]);
+
+        shader.bind();
+        shader.unBind();
+    }
+
+    measure(suite, "switch_set_8", "by_name", numSwitches, [&]() {
+        for (size_t i = 0; i < numSwitches; i++) {
+            Material& material = materials[i % 2];
+            Shader& shader = material._shader;
+            shader.bind();
+            shader.setVariable("baseColor", material._color);
+            shader.setVariable("modelMatrix", material._modelMatrix);
+            for (size_t j = 0; j < 6; j++)
+                shader.setVariable(floatNames[j], j == highlightIdx ? (float)(i % 16) / 16.0f : floatValues[j]);
+            shader.unBind();
+        }
+        glFinish();
+    });
+
+    measure(suite, "switch_set_8", "by_handle", numSwitches, [&]() {
+        for (size_t i = 0; i < numSwitches; i++) {
+            Material& material = materials[i % 2];
+            Shader& shader = material._shader;
+            shader.bind();
+            shader.setVariable(material._colorHandle, material._color);
+            shader.setVariable(material._matrixHandle, material._modelMatrix);
+            for (size_t j = 0; j < 6; j++)
+                shader.setVariable(material._floatHandles[j], j == highlightIdx ? (float)(i % 16) / 16.0f : floatValues[j]);
+            shader.unBind();
+        }
+        glFinish();
+    });
+}
+
+/*
+    Per frame cost of camera and lights shared by 8 programs. A frame moves the camera and binds each program once.
+    uniforms sets the 2 matrices, the light count and 4 light directions in every program, through handles. parameter_block
+    sets them once in a ParameterBlock, which is written to its ring and bound when the first program is bound.
+*/
+void benchSharedParameters()
+{
+    if (!ParameterBlock::isSupported())
+        return;
+
+    const string suite = "shader";
+    const size_t numPrograms = 8, numLights = 4;
+    const size_t numFrames = g_options._quick ? 500 : 5000;
+
+    p3f lightDirs[numLights] = { p3f(0.0f, 0.0f, 1.0f), p3f(1.0f, 0.0f, 0.0f), p3f(0.0f, 1.0f, 0.0f), p3f(0.577f, 0.577f, 0.577f) };
+    auto setCamera = [](m44f& modelView, size_t frame) {
+        modelView = m44f();
+        modelView[0].w = (float)(frame % 100) * 0.01f;
+    };
+
+    auto makeShader = [&](Shader& shader, size_t i, const char* pParamsSrc) {
+        string vertexSrc = "#version 330\n#define SCALE " + to_string(1.0 + 0.1 * i) + "\n" + pParamsSrc + s_sharedVertexSrc;
+        shader.setVertexSrc(vertexSrc);
+        shader.setFragmentSrc(s_sharedFragmentSrc);
+        shader.setShaderVertexAttribName("inPosition");
+        shader.setShaderNormalAttribName("inNormal");
+    };
+
+    struct UniformProgram {
+        Shader _shader;
+        ShaderBase::UniformHandle _modelView, _proj, _numLights, _lightDirs[numLights];
+    };
+
+    vector<UniformProgram> uniformPrograms(numPrograms);
+    m44f modelView, proj;
+    for (size_t i = 0; i < numPrograms; i++) {
+        UniformProgram& program = uniformPrograms[i];
+        makeShader(program._shader, i, s_sharedParamsSrc);
+        program._modelView = program._shader.setVariable("modelView", modelView);
+        program._proj = program._shader.setVariable("proj", proj);
+        program._numLights = program._shader.setVariablei("numLights", (int)numLights);
+        for (size_t j = 0; j < numLights; j++)
+            program._lightDirs[j] = program._shader.setVariable("lightDir[" + to_string(j) + "]", lightDirs[j]);
+        program._shader.bind();
+        program._shader.unBind();
+    }
+
+    auto pBlock = make_shared<ParameterBlock>("UniformBufferObject", 0);
+    vector<Shader> blockPrograms(numPrograms);
+    for (size_t i = 0; i < numPrograms; i++) {
+        makeShader(blockPrograms[i], i, s_sharedBlockSrc);
+        blockPrograms[i].addParameterBlock(pBlock);
+        blockPrograms[i].bind();
+        blockPrograms[i].unBind();
+    }
+
+    measure(suite, "frame_8_programs", "uniforms", numFrames, [&]() {
+        for (size_t frame = 0; frame < numFrames; frame++) {
+            setCamera(modelView, frame);
+            for (auto& program : uniformPrograms) {
+                Shader& shader = program._shader;
+                shader.bind();
+                shader.setVariable(program._modelView, modelView);
+                shader.setVariable(program._proj, proj);
+                shader.setVariablei(program._numLights, (int)numLights);
+                for (size_t j = 0; j < numLights; j++)
+                    shader.setVariable(program._lightDirs[j], lightDirs[j]);
+                shader.unBind();
+            }
+        }
+        glFinish();
+    });
+
+    measure(suite, "frame_8_programs", "parameter_block", numFrames, [&]() {
+        for (size_t frame = 0; frame < numFrames; frame++) {
+            setCamera(modelView, frame);
+            pBlock->setVariable("modelView", modelView);
+            pBlock->setVariable("proj", proj);
+            pBlock->setVariablei("numLights", (int)numLights);
+            for (size_t j = 0; j < numLights; j++)
+                pBlock->setVariable("lightDir[" + to_string(j) + "]", lightDirs[j]);
+
+            for (auto& shader : blockPrograms) {
+                shader.bind();
+                shader.unBind();
+            }
+        }
+        glFinish();
+    });
+}
+
+void writeJson(ostream& out)
+{
+    out << "{\n";
+    out << "  \"context\": { \"renderer\": \"" << g_renderer << "\", \"reps\": " << g_options._reps
+        << ", \"quick\": " << (g_options._quick ? "true" : "false") << ", \"gl_error_check\": \"" << glErrorCheckName() << "\" },\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < g_results.size(); i++) {
+        const auto& res = g_results[i];
+        char buf[512];
+        snprintf(buf, sizeof(buf),
+            "    { \"suite\": \"%s\", \"name\": \"%s\", \"variant\": \"%s\", \"threads\": 1, \"ops\": %zu, \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f }%s\n",
+            res._suite.c_str(), res._name.c_str(), res._variant.c_str(), res._ops, res._nsPerOp, res._minNsPerOp,
+            i + 1 < g_results.size() ? "," : "");
+        out << buf;
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+void writeCsv(ostream& out)
+{
+    out << "suite,name,variant,threads,ops,ns_per_op,min_ns_per_op\n";
+    for (const auto& res : g_results) {
+        char buf[512];
+        snprintf(buf, sizeof(buf), "%s,%s,%s,1,%zu,%.3f,%.3f\n",
+            res._suite.c_str(), res._name.c_str(), res._variant.c_str(), res._ops, res._nsPerOp, res._minNsPerOp);
+        out << buf;
+    }
+}
+
+bool parseArgs(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--quick")
+            g_options._quick = true;
+        else if (arg == "--reps" && hasValue)
+            g_options._reps = max<size_t>(strtoul(argv[++i], nullptr, 10), 1);
+        else if (arg == "--filter" && hasValue)
+            g_options._filter = argv[++i];
+        else if (arg == "--format" && hasValue)
+            g_options._format = argv[++i];
+        else if (arg == "--out" && hasValue)
+            g_options._outPath = argv[++i];
+        else
+            return false;
+    }
+
+    return g_options._format == "json" || g_options._format == "csv";
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!parseArgs(argc, argv)) {
+        fprintf(stderr, "usage: %s [--quick] [--reps N] [--filter text] [--format json|csv] [--out file]\n", argv[0]);
+        return 1;
+    }
+
+    OffscreenContext context;
+    if (!context.create(1024, 768)) {
+        fprintf(stderr, "Could not create an offscreen EGL context\n");
+        return 2;
+    }
+    fprintf(stderr, "Renderer: %s\n", g_renderer.c_str());
+
+    benchMultiVboHandler();
+    benchStreaming();
+    benchShaderUniforms();
+    benchSharedParameters();
+
+    ofstream outFile;
+    if (!g_options._outPath.empty()) {
+        outFile.open(g_options._outPath);
+        if (!outFile) {
+            fprintf(stderr, "Could not open %s\n", g_options._outPath.c_str());
+            return 1;
+        }
+    }
+    ostream& out = outFile.is_open() ? outFile : cout;
+
+    if (g_options._format == "csv")
+        writeCsv(out);
+    else
+        writeJson(out);
+
+    return 0;
+}
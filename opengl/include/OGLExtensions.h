@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 #define GL_GLEXT_PROTOTYPES
 #ifdef WIN32
 #include <Windows.h>
@@ -7,8 +9,8 @@
 #include <GL/glext.h>
 #include <GL/wglext.h>
 #else
-#include "/usr/include/GL/gl.h"
-#include "/usr/include/GL/glext.h"
+#include <GL/gl.h>
+#include <GL/glext.h>
 #endif
 
 #define HAS_SHADER_SUBROUTINES 1
@@ -24,6 +26,43 @@ public:
 
     static bool hasVBOSupport();    //< pretty much a given, but just in case
     Extensions();
+
+    /*
+        Shadow copy of the GL state the library changes while drawing. A call which wouldn't change anything isn't issued and the getters
+        read the shadow instead of querying GL. Unknown state is always issued, or queried once by a getter.
+        There's one shadow, for the current context on the drawing thread. Code which changes this state behind its back, including
+        glPushAttrib/glPopAttrib, switching contexts or raw glDelete* calls, must call invalidate afterwards.
+    */
+    class GLState
+    {
+    public:
+        struct Counters {
+            size_t m_issued = 0;    // Calls passed on to GL
+            size_t m_filtered = 0;  // Calls dropped because the state already matched
+            size_t m_queries = 0;   // glGet calls made to fill unknown state
+        };
+
+        static void bindBuffer(GLenum target, GLuint buffer); // Only the targets the library uses are tracked, others are passed through
+        static void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size); // Also binds the generic target
+        static void bindVertexArray(GLuint vao);
+        static void useProgram(GLuint program);
+        static void deleteBuffers(GLsizei n, const GLuint* pBuffers);
+        static void deleteVertexArrays(GLsizei n, const GLuint* pArrays);
+
+        static void setEnabled(GLenum cap, bool enabled);
+        static bool isEnabled(GLenum cap);
+        static void cullFace(GLenum mode);
+        static GLenum getCullFace();
+        static void colorMaterial(GLenum face, GLenum mode);
+        static void getColorMaterial(GLenum& face, GLenum& mode);
+
+        static void invalidate();
+        static void invalidateVertexArrayState(); // Array and element buffer bindings, after glPopClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT)
+
+        static const Counters& getCounters();
+        static void resetCounters();
+    };
+
 #ifdef WIN32
     static PFNGLACTIVESHADERPROGRAMPROC glActiveShaderProgram;
     static PFNGLACTIVETEXTUREPROC glActiveTexture;
@@ -17,6 +17,7 @@
 namespace OGL
 {
 class ShaderBase;
+class StreamBuffer;
 
 class ElementVBORec : public Extensions {
 public:
@@ -36,6 +37,41 @@ private:
     GLuint  m_elementIdxVboID;
 };
 
+/*
+    Byte offsets of each attribute within one vertex of an interleaved buffer, -1 if the attribute isn't stored. Positions are 3 floats.
+    By default normals and colors are 3 floats and texture coordinates are 2. A stride of 0 means separate buffers, one per attribute, all floats.
+
+    The compact types only apply to interleaved layouts, each packs its attribute into 4 bytes:
+        normals     GL_INT_2_10_10_10_REV, normalized, w unused
+        colors      GL_UNSIGNED_BYTE, normalized RGBA with alpha 1
+        tex coords  GL_HALF_FLOAT
+*/
+struct VertexLayout {
+    // Attributes packed in the order position, normal, texture coordinate, color
+    static VertexLayout packed(bool normals, bool texCoords, bool colors);
+    // Same order using the compact types, 24 bytes per vertex with everything instead of 44
+    static VertexLayout compact(bool normals, bool texCoords, bool colors);
+
+    // Bytes one attribute of type occupies, numComponents is the number of floats it's made from
+    static GLint attribBytes(GLenum type, GLint numComponents);
+    // The size argument to glVertexAttribPointer, packed types are read as 4 components
+    static GLint attribSize(GLenum type, GLint numComponents);
+
+    bool isInterleaved() const;
+    bool isValid() const;
+    size_t floatsPerVertex() const; // Number of 32 bit words, packed attributes are stored by bit pattern
+
+    GLsizei m_stride = 0;
+    GLint m_positionOffset = 0;
+    GLint m_normalOffset = -1;
+    GLint m_texCoordOffset = -1;
+    GLint m_colorOffset = -1;
+
+    GLenum m_normalType = GL_FLOAT;
+    GLenum m_texCoordType = GL_FLOAT;
+    GLenum m_colorType = GL_FLOAT;
+};
+
 class MultiVBO : public Extensions
 {
     friend class MultiVboHandler;
@@ -54,6 +90,12 @@ public:
     // the buffer.
     static bool isValid_unbindsVBO(GLuint& vboID);
 
+    // True if the context has vertex array objects. Then the attribute setup is recorded once in a VAO and a draw is bind VAO, bind elements, draw.
+    // Without them every draw pushes the attributes, binds each buffer and pops.
+    static bool isVertexArraySupported();
+    // GL 4.3 or GL_ARB_multi_draw_indirect, and vertex array objects
+    static bool isMultiDrawIndirectSupported();
+
     MultiVBO(int m_primitiveType);
     virtual ~MultiVBO();
     size_t numBytes() const;
@@ -66,6 +108,12 @@ public:
     virtual bool copyToVBO(const std::vector<float>& verts, const std::vector<float>& colors, int dataID = 0);    ///replaces whatever was there before, normal size == vertex size && tex size is 2/3 of vertex size or has no size
     virtual bool copyToVBO(const std::vector<float>& verts, int dataID = 0);    ///replaces whatever was there before, normal size == vertex size && tex size is 2/3 of vertex size or has no size
 
+    // Replaces the contents with one interleaved buffer. data holds layout.m_stride bytes per vertex.
+    bool copyInterleavedToVBO(const std::vector<float>& data, const VertexLayout& layout, bool smoothNrmls, int dataID = 0);
+    // Interleaved version of copyRangeToExistingVBO
+    bool copyInterleavedRangeToExistingVBO(size_t firstVert, size_t numVerts, const std::vector<float>& data, bool smoothNrmls);
+    const VertexLayout& getVertexLayout() const;
+
     // For best performance, the object keeps large, complete VBOs for all the geometry (verts, normals etc) and the caller draws from that VBO using 
     // element id lists. The lists can be in the form of a raw list or element VBO ids. This object maintains a list of elementVBO ids and it is also possible for
     // the user to keep their own lists separately.
@@ -82,14 +130,29 @@ public:
     virtual bool drawVBOIndexVBO(const ShaderBase* pShader, GLsizei numElements, GLuint indexVBOId, DrawVertexColorMode drawColors = DRAW_COLOR_NONE) const;
     virtual bool drawVBO(const ShaderBase* pShader, const std::vector<unsigned int>& indices = std::vector<unsigned int>(), DrawVertexColorMode drawColors = DRAW_COLOR_NONE) const;
 
+    // Packs several index lists back to back into one element buffer, with one indirect draw command per list. Empty lists are skipped.
+    // drawIndirect then draws every list, in order, with a single glMultiDrawElementsIndirect. This is independent of the keyed element VBOs.
+    bool setIndirectDraws(const std::vector<const std::vector<unsigned int>*>& indexLists);
+    bool drawIndirect(const ShaderBase* pShader, DrawVertexColorMode drawColors = DRAW_COLOR_NONE) const;
+
     bool usingSmoothNormals() { return m_smoothNormals; }
     bool usingRegionalNormals() { return m_regionalNormals; }
     bool usingColors() { return m_colors; }
+    bool hasColorData() const;
     bool usingBackColors() { return m_backColors; }
 
     void setUseSmoothNormal(bool set);
     virtual void setUseRegionalNormal(bool set);
 
+    // Sends verts [firstVert, firstVert + numVerts) of arrays the same size and layout as the last copyToVBO call, using glBufferSubData.
+    // Returns false without changing anything if the sizes or layout don't match, the caller should use copyToVBO instead.
+    bool copyRangeToExistingVBO(size_t firstVert, size_t numVerts, const std::vector<float>& verts, const std::vector<float>& normals, bool smoothNrmls,
+        const std::vector<float>& textureCoords, const std::vector<float>& colors);
+
+    // Partial copies go through the stream buffer when one is set. It must outlive this object. The source arrays are copied into the ring, so this
+    // costs one copy more than glBufferSubData, see MultiVboHandler::setStreamBuffer.
+    void setStreamBuffer(StreamBuffer* pStreamBuffer);
+
     bool copyVertecesToExistingVBO(const std::vector<float>& verts);
 
     bool copyNormalsToExistingVBO(const std::vector<float>& normals, bool smooth);
@@ -122,8 +185,14 @@ protected:
     bool areVBOsValid(size_t numElements, GLuint elementIdxVboID, DrawVertexColorMode drawColors) const;
     bool bindCommon(const ShaderBase* pShader, size_t numElements) const;
     void unbindCommon() const;
+    bool bindAttributes(const ShaderBase* pShader) const;
+    void unbindAttributes() const;
+    void bindVertexArray(const ShaderBase* pShader) const;
+    void setVertexArrayColors(const ShaderBase* pShader, DrawVertexColorMode drawColors) const;
+    bool drawVBOIndexVAO(const ShaderBase* pShader, GLsizei numElements, GLuint indexVBOId, DrawVertexColorMode drawColors) const;
     template<class T>
     static bool assureVBOValid(const std::vector<T>& vec, GLuint& vboID, int& valid);
+    void copySubData(GLuint vboID, size_t dstOffset, size_t numBytes, const void* pSrc);
 
     const int m_primitiveType;
 
@@ -142,8 +211,117 @@ protected:
     GLuint m_colorVboID;
     GLuint m_backColorVboID;
     std::map<int, ElementVBORec> m_elementVBOIDMap;
+    StreamBuffer* m_pStreamBuffer = nullptr;
+    VertexLayout m_layout; // Interleaved if m_layout.m_stride != 0, then everything except back colors is in m_vertexVboID
+
+    mutable GLuint m_vaoID = 0;
+    mutable bool m_vaoDirty = true;   // A buffer was created or deleted, or the layout changed, since the VAO was recorded
+    mutable bool m_vaoBound = false;  // Bound by bindCommon, so draws don't bind and unbind it
+    mutable GLuint m_vaoLocs[4] = { GLuint(-1), GLuint(-1), GLuint(-1), GLuint(-1) }; // Shader locations the VAO was recorded with
+    mutable DrawVertexColorMode m_vaoColorMode = DRAW_COLOR_NONE; // Which color array the VAO is set up for
+
+    GLuint m_indirectElementVboID = 0;
+    GLuint m_indirectCommandVboID = 0;
+    GLsizei m_numIndirectDraws = 0;
 };
 
+inline VertexLayout VertexLayout::packed(bool normals, bool texCoords, bool colors)
+{
+    VertexLayout result;
+    GLint offset = 3 * sizeof(float);
+    if (normals) {
+        result.m_normalOffset = offset;
+        offset += 3 * sizeof(float);
+    }
+    if (texCoords) {
+        result.m_texCoordOffset = offset;
+        offset += 2 * sizeof(float);
+    }
+    if (colors) {
+        result.m_colorOffset = offset;
+        offset += 3 * sizeof(float);
+    }
+    result.m_stride = offset;
+    return result;
+}
+
+inline VertexLayout VertexLayout::compact(bool normals, bool texCoords, bool colors)
+{
+    VertexLayout result;
+    result.m_normalType = GL_INT_2_10_10_10_REV;
+    result.m_texCoordType = GL_HALF_FLOAT;
+    result.m_colorType = GL_UNSIGNED_BYTE;
+
+    GLint offset = 3 * sizeof(float);
+    if (normals) {
+        result.m_normalOffset = offset;
+        offset += attribBytes(result.m_normalType, 3);
+    }
+    if (texCoords) {
+        result.m_texCoordOffset = offset;
+        offset += attribBytes(result.m_texCoordType, 2);
+    }
+    if (colors) {
+        result.m_colorOffset = offset;
+        offset += attribBytes(result.m_colorType, 3);
+    }
+    result.m_stride = offset;
+    return result;
+}
+
+inline GLint VertexLayout::attribBytes(GLenum type, GLint numComponents)
+{
+    switch (type) {
+    case GL_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_BYTE:
+        return 4;
+    case GL_HALF_FLOAT:
+        return numComponents * 2;
+    default:
+        return numComponents * sizeof(float);
+    }
+}
+
+inline GLint VertexLayout::attribSize(GLenum type, GLint numComponents)
+{
+    return (type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_BYTE) ? 4 : numComponents;
+}
+
+inline bool VertexLayout::isInterleaved() const
+{
+    return m_stride != 0;
+}
+
+inline bool VertexLayout::isValid() const
+{
+    if (!isInterleaved())
+        return m_normalType == GL_FLOAT && m_texCoordType == GL_FLOAT && m_colorType == GL_FLOAT;
+    if ((m_normalType != GL_FLOAT && m_normalType != GL_INT_2_10_10_10_REV) || (m_texCoordType != GL_FLOAT && m_texCoordType != GL_HALF_FLOAT) ||
+        (m_colorType != GL_FLOAT && m_colorType != GL_UNSIGNED_BYTE))
+        return false;
+
+    auto fits = [this](GLint offset, GLenum type, GLint numComponents) {
+        return offset == -1 || (offset >= 0 && offset % sizeof(float) == 0 && offset + attribBytes(type, numComponents) <= m_stride);
+    };
+    return m_stride % sizeof(float) == 0 && m_positionOffset != -1 && fits(m_positionOffset, GL_FLOAT, 3) && fits(m_normalOffset, m_normalType, 3) &&
+        fits(m_texCoordOffset, m_texCoordType, 2) && fits(m_colorOffset, m_colorType, 3);
+}
+
+inline size_t VertexLayout::floatsPerVertex() const
+{
+    return m_stride / sizeof(float);
+}
+
+inline const VertexLayout& MultiVBO::getVertexLayout() const
+{
+    return m_layout;
+}
+
+inline bool MultiVBO::hasColorData() const
+{
+    return m_layout.isInterleaved() ? m_layout.m_colorOffset != -1 : m_colorVboID != 0;
+}
+
 inline size_t ElementVBORec::getNumElements() const
 {
     return m_mumElements;
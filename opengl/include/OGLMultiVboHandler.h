@@ -65,6 +65,17 @@ public:
 
     void setShader(const ShaderBase* pShader);
 
+    // Partial uploads go through pStreamBuffer, nullptr, the default, turns streaming off. The handler doesn't own it and it must outlive the handler's batches.
+    // Ranges are still copied from the handler's arrays into the ring, then by the GPU into the VBO, one copy more than glBufferSubData. That only pays
+    // where glBufferSubData stalls on buffers the GPU is reading. On llvmpipe, where the GPU copy is a memcpy too, the ring is slower, so leave it off
+    // unless ogl_bench's edit_face *_stream variants win on the target hardware.
+    void setStreamBuffer(StreamBuffer* pStreamBuffer);
+
+    // Must be set while the handler is empty. An interleaved layout stores each batch in one VBO, the default keeps one VBO per attribute.
+    // Colors passed to a layout without a color slot are dropped.
+    void setVertexLayout(const VertexLayout& layout);
+    const VertexLayout& getVertexLayout() const;
+
     // This defines the draw order for keys.
     // Drawing is done in layers, with lowest numbered layer first.
     // Each layer has a set of draw keys and those keys are drawn in that layer
@@ -124,6 +135,11 @@ public:
     template<typename PRE_FUNC, typename POST_FUNC, typename PRE_TEX_FUNC, typename POST_TEX_FUNC>
     void drawAllKeys(PRE_FUNC preDrawFunc, POST_FUNC postDrawFunc, PRE_TEX_FUNC preDrawTexFunc, POST_TEX_FUNC postDrawTexFunc) const;
 
+    // Draws the same keys, in the same order, as drawAllKeys with one glMultiDrawElementsIndirect per batch. There are no per key callbacks,
+    // every key is drawn with the current state and drawColors. Textured faces are not drawn. The indirect buffers are rebuilt after the element
+    // indices change. Without multi draw indirect support this falls back to one draw per key.
+    void drawAllKeysIndirect(MultiVBO::DrawVertexColorMode drawColors = MultiVBO::DRAW_COLOR_NONE) const;
+
     bool getVert(const Index& glIndicesOut, float coords[3]) const;
     bool getNormal(const Index& glIndicesOut, float coords[3]) const;
 
@@ -167,17 +183,22 @@ private:
         // for now, this is pure structure with no code.
 
         // CPU side representation
-        size_t m_nextFreeVertIndex = 0; // This used to make blocks of similar sizes for reuse
+        size_t m_nextFreeVertIndex = 0; // New blocks are appended here. The arrays are usually larger, leaving room to grow without resizing the VBO
 
-        bool m_needsUpdate = true;
-        // These accumulate between begin/end tessellation calls. They should be clear after VBO creation
+        // [first, last) vertex ranges written since the last upload. Only these are sent to the card if the VBO is already the right size.
+        std::vector<std::pair<size_t, size_t>> m_dirtyVertRanges;
+
+        // Copy of the VBO contents. These are kept after the upload so an edit only has to send the vertices it changed.
         std::vector<float> m_points, m_normals, m_parameters;
         std::vector<float> m_colors, m_backColors;
+        std::vector<float> m_interleaved; // Used instead of the points, normals, parameters and colors arrays if the layout is interleaved
         std::map<int, std::vector<unsigned int>> m_indexMap;
         std::vector<std::shared_ptr<ElemIndexMapRec>> m_texturedFaces;
 
         std::vector<size_t> m_allocatedChunks; // The index is the chunk number and the value is the number of allocated chunks at that index
 
+        bool m_indirectDirty = true; // The element indices changed since the indirect draws were built
+
         // Video card representation
         MultiVBO m_VBO;
     };
@@ -208,6 +229,15 @@ private:
     void setFaceTessellationInner(size_t batchIndex, size_t chunkIndex, const std::vector<float>& points, const std::vector<float>& normals, const std::vector<float>& parameters,
         const std::vector<float>& colors, const std::vector<unsigned int>& triIndices, Indices& glIndicesOut);
 
+    size_t batchCapacity(const VertexBatch& batch) const;
+    // Packs or unpacks one attribute of the layout. type is the attribute's type in the layout, numComponents the number of floats it's made from.
+    void writeInterleaved(VertexBatch& batch, size_t vertBaseIndex, size_t numVerts, GLint offset, GLenum type, int numComponents, const std::vector<float>& src) const;
+    void writeInterleaved(VertexBatch& batch, size_t vertBaseIndex, size_t numVerts, GLint offset, GLenum type, int numComponents, const float* pSrc, size_t srcStride) const;
+    bool readInterleaved(const VertexBatch& batch, size_t vertIdx, GLint offset, GLenum type, int numComponents, float* pDst) const;
+
+    void markVertsDirty(VertexBatch& batch, size_t firstVert, size_t numVerts);
+    void uploadBatch(VertexBatch& batch, bool smoothNormals);
+
     void setEdgeStripTessellationInner(size_t batchIndex, size_t vertChunkIndex, const std::vector<float>& lineStripPts, Indices& glIndicesOut);
     void setEdgeSegTessellationInner(size_t batchIndex, size_t vertChunkIndex, const std::vector<float>& pts, const std::vector<float>& colors, const std::vector<unsigned int>& indices, Indices& glIndicesOut);
 
@@ -216,6 +246,7 @@ private:
     void drawKeyForBatch(int key, const std::shared_ptr<VertexBatch>& batchPtr, MultiVBO::DrawVertexColorMode drawColors) const;
     void drawTexturedFaces(const std::shared_ptr<VertexBatch>& batchPtr) const;
     void unbindCommonBuffers(const std::shared_ptr<VertexBatch>& batchPtr) const;
+    void getKeysInDrawOrder(const VertexBatch& batch, std::vector<int>& keys) const;
     void initLayerToKeyMap(int maxKeyIndex);
 
     // This should only be called from doGarbageCollection
@@ -230,6 +261,8 @@ private:
     bool m_clearAllLayers = true;
     size_t m_layerBitMask = 0;
     const ShaderBase* m_pShader = nullptr;
+    StreamBuffer* m_pStreamBuffer = nullptr;
+    VertexLayout m_layout;
     std::vector<int> m_keysLayer;
     std::vector<std::vector<int>> m_layersKeys;
     std::vector<std::shared_ptr<VertexBatch>> m_batches;
@@ -241,6 +274,11 @@ inline void MultiVboHandler::setShader(const ShaderBase* pShader)
     m_pShader = pShader;
 }
 
+inline const VertexLayout& MultiVboHandler::getVertexLayout() const
+{
+    return m_layout;
+}
+
 inline bool MultiVboHandler::empty() const
 {
     return m_batches.empty();
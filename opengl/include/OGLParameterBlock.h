@@ -0,0 +1,102 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OGLExtensions.h> // Before OGLShader.h, for the GL prototypes
+#include <OGLShader.h>
+#include <OGLStreamBuffer.h>
+
+namespace OGL
+{
+/*
+    Uniform block shared by several shader programs, such as camera and lights. The values are written once into a uniform buffer
+    and bound to a binding point with glBindBufferRange, instead of setting each uniform in each program.
+
+    Add the block to every shader which declares it (ShaderBase::addParameterBlock). When a program is linked its block is assigned
+    the binding point, and the first program gives the block its layout, so the block must be declared the same way, with the shared
+    or std140 layout, in all of them. Values set before that are kept and written once the layout is known.
+
+    Members are set by their GLSL name, array elements as "lightDir[2]". commit writes the block into the next slot of a ring
+    (StreamBuffer), so frames the GPU hasn't finished keep their values, and binds it. ShaderBase::bind commits blocks which
+    changed, so it's normally called once per frame, when the first shader is bound after the values were set.
+*/
+class ParameterBlock : public Extensions
+{
+public:
+    static bool isSupported();
+
+    ParameterBlock(const std::string& blockName, GLuint bindingPoint);
+    ParameterBlock(const ParameterBlock& src) = delete;
+    ~ParameterBlock();
+
+    ParameterBlock& operator = (const ParameterBlock& rhs) = delete;
+
+    const std::string& getName() const;
+    GLuint getBindingPoint() const;
+    bool hasLayout() const;
+    bool isDirty() const;
+
+    void setVariablei(const std::string& name, int  value);
+    void setVariable(const std::string& name, float  value);
+    void setVariable(const std::string& name, const col4f& value);
+    void setVariable(const std::string& name, const m44f& value);
+    void setVariable(const std::string& name, const p4f& value);
+    void setVariable(const std::string& name, const p3f& value);
+    void setVariable(const std::string& name, const p2f& value);
+
+    // Writes the block and binds it, if it changed since the last commit. Does nothing until a program has given it a layout.
+    void commit();
+
+private:
+    friend class ShaderBase;
+
+    struct Member {
+        GLint m_offset = 0, m_arraySize = 1, m_arrayStride = 0, m_matrixStride = 0;
+        GLenum m_type = GL_FLOAT;
+        bool m_rowMajor = false;
+    };
+
+    using ArgMapType = std::map<const std::string, std::shared_ptr<Arg>>;
+
+    void createBuffer();
+    void setLayout(GLuint programId, GLuint blockIndex);
+    template<class MAKE_ARG_FUNC, class T>
+    void setArgValue(const std::string& name, MAKE_ARG_FUNC makeArg, T value);
+    void writeValue(const std::string& name, Arg& arg);
+
+    const std::string m_name;
+    const GLuint m_bindingPoint;
+    std::map<std::string, Member> m_layout;
+    ArgMapType m_values;
+    std::vector<char> m_data;
+    bool m_dirty = true;
+
+    std::unique_ptr<StreamBuffer> m_pRing;
+    size_t m_offsetAlignment = 256;
+    GLuint m_bufferId = 0; // Bound instead of the ring when the ring isn't persistently mapped, or a slot couldn't be allocated
+};
+
+inline const std::string& ParameterBlock::getName() const
+{
+    return m_name;
+}
+
+inline GLuint ParameterBlock::getBindingPoint() const
+{
+    return m_bindingPoint;
+}
+
+inline bool ParameterBlock::hasLayout() const
+{
+    return !m_data.empty();
+}
+
+inline bool ParameterBlock::isDirty() const
+{
+    return m_dirty;
+}
+
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <vector>
 
 #ifdef WIN32
 #include <Windows.h>
@@ -24,15 +25,28 @@
 
 #include <OGLCol4f.h>
 
+// 0 compiles GL_ASSERT away, 1 checks at every GL_ASSERT and 2 checks at one GL_ASSERT in every getGlErrorSampleInterval.
+// The CMake option OGL_GL_ERROR_CHECK sets this, otherwise it follows _DEBUG.
+#ifndef OGL_GL_ERROR_CHECK
 #ifdef _DEBUG
-#define GL_ASSERT ::OGL::ShaderBase::dumpGlErrors(__FILE__, __LINE__);
+#define OGL_GL_ERROR_CHECK 1
+#else
+#define OGL_GL_ERROR_CHECK 0
+#endif
+#endif
+
+#if OGL_GL_ERROR_CHECK == 1
+#define GL_ASSERT ::OGL::ShaderBase::checkGlErrors(__FILE__, __LINE__);
+#elif OGL_GL_ERROR_CHECK == 2
+#define GL_ASSERT ::OGL::ShaderBase::sampleGlErrors(__FILE__, __LINE__);
 #else
 #define GL_ASSERT
-#endif // _DEBUG
+#endif
 
 namespace OGL
 {
     class Arg;
+    class ParameterBlock;
     class Texture;
     class ActiveTextureUnits;
 
@@ -52,8 +66,23 @@ namespace OGL
     public:
         using ArgMapType = std::map<const std::string, std::shared_ptr<Arg>>;
 
+        // Index into the shader's uniform table. Setting through a handle skips the name lookup, get it from the first set by name or from findUniform.
+        using UniformHandle = int;
+        static const UniformHandle INVALID_UNIFORM = -1;
+
         static void dumpGlErrors(const char* filename, int lineNumber);
 
+        /*
+            In a debug context the first check installs a synchronous KHR_debug callback. Errors are then reported by the driver as
+            they happen, along with the last GL_ASSERT location passed, and checkGlErrors doesn't call glGetError.
+            Other contexts fall back to glGetError. Call installDebugCallback again after making a new context current.
+        */
+        static void checkGlErrors(const char* filename, int lineNumber);
+        static void sampleGlErrors(const char* filename, int lineNumber);
+        static bool installDebugCallback();
+        static void setGlErrorSampleInterval(size_t interval); // 0 turns sampling off
+        static size_t getGlErrorSampleInterval();
+
 #if TEXTURE_SUPPORT
         using TextureMapType = std::map<const std::string, std::shared_ptr<Texture>>;
 #endif
@@ -78,13 +107,29 @@ namespace OGL
 
         void loadDefaultVariables(); ///< Loads defaults (resets to default) variables defined in the shader file
 
-        void setVariablei(const std::string& name, int  value);
-        void setVariable(const std::string& name, float  value);
-        void setVariable(const std::string& name, const col4f& value);
-        void setVariable(const std::string& name, const m44f& value);
-        void setVariable(const std::string& name, const p4f& value);
-        void setVariable(const std::string& name, const p3f& value);
-        void setVariable(const std::string& name, const p2f& value);
+        /*
+            Uniform locations are resolved once, when the variable is added or when the program is linked.
+            Values are uploaded when they change while bound, otherwise on the next bind. Unchanged values aren't sent again.
+        */
+        UniformHandle setVariablei(const std::string& name, int  value);
+        UniformHandle setVariable(const std::string& name, float  value);
+        UniformHandle setVariable(const std::string& name, const col4f& value);
+        UniformHandle setVariable(const std::string& name, const m44f& value);
+        UniformHandle setVariable(const std::string& name, const p4f& value);
+        UniformHandle setVariable(const std::string& name, const p3f& value);
+        UniformHandle setVariable(const std::string& name, const p2f& value);
+
+        UniformHandle findUniform(const std::string& name) const; // INVALID_UNIFORM until the variable has been set by name
+        void setVariablei(UniformHandle handle, int  value);
+        void setVariable(UniformHandle handle, float  value);
+        void setVariable(UniformHandle handle, const col4f& value);
+        void setVariable(UniformHandle handle, const m44f& value);
+        void setVariable(UniformHandle handle, const p4f& value);
+        void setVariable(UniformHandle handle, const p3f& value);
+        void setVariable(UniformHandle handle, const p2f& value);
+
+        // Shared uniform block, see ParameterBlock. Add it to every shader which declares it.
+        void addParameterBlock(const std::shared_ptr<ParameterBlock>& pBlock);
 
 #if HAS_SHADER_SUBROUTINES
         void setVertSubRoutine(const char* name);
@@ -147,6 +192,13 @@ namespace OGL
 #endif
         void   clearTextures();
 
+        template<class MAKE_ARG_FUNC>
+        UniformHandle findOrAddUniform(const std::string& name, MAKE_ARG_FUNC makeArg);
+        template<class T>
+        void setArgValue(UniformHandle handle, T value);
+        void uploadUniform(Arg& arg) const;
+        void attachParameterBlock(ParameterBlock& block);
+
         static bool mEnabled;
         bool m_defaultsLoaded;
         bool m_bound;
@@ -157,6 +209,8 @@ namespace OGL
         int _programId = 0, _vertexId = 0, _fragmentId = 0, _geometryId = 0;
 
         ArgMapType  m_argumentMap; /// map of arguments matched to shader inputs
+        std::vector<std::shared_ptr<Arg>> m_uniformTable; /// the same arguments, indexed by UniformHandle
+        std::vector<std::shared_ptr<ParameterBlock>> m_parameterBlocks; /// shared uniform blocks bound to this program
 
         ActiveTextureUnits* m_textureUnitStates; /// texture units bound to the card, primary use is gl state management
     };
@@ -259,8 +313,14 @@ namespace OGL
         argtype getType() { return type; }
 
     private:
+        friend class ShaderBase;
+        friend class ParameterBlock;
+
         void allocFloat(const float* val, int numFloats);
         argtype type;
+        ShaderBase::UniformHandle handle = ShaderBase::INVALID_UNIFORM;
+        GLint location = -1;
+        bool dirty = true; // Changed since it was last sent to the program
 
         union
         {
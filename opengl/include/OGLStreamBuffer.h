@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+
+#include <OGLExtensions.h>
+
+namespace OGL
+{
+/*
+    Ring of GPU visible memory for streaming uploads.
+
+    The buffer has immutable storage (glBufferStorage), mapped once with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT and divided into regions,
+    three by default. Allocations are carved from the current region. When it's full, or at nextRegion, a fence is placed after the commands
+    which read the region and the next region is used, waiting on its fence if the GPU is still reading it.
+
+    The data is written straight into the mapping, then copyTo has the GPU copy it into the destination buffer. Without buffer storage
+    (before GL 4.4) the ring is a CPU staging array and copyTo uses glBufferSubData.
+
+    Memory returned by alloc may be filled from any thread, as long as it's finished before copyTo. All other calls must be made on the
+    thread which owns the GL context.
+*/
+class StreamBuffer : public Extensions
+{
+public:
+    static bool isPersistentSupported();
+
+    StreamBuffer(size_t regionBytes = 4 * 1024 * 1024, size_t numRegions = 3);
+    StreamBuffer(const StreamBuffer& src) = delete;
+    ~StreamBuffer();
+
+    StreamBuffer& operator = (const StreamBuffer& rhs) = delete;
+
+    bool isPersistent() const;
+    size_t regionBytes() const;
+    GLuint bufferId() const;
+
+    // Returns memory and its offset in the buffer, or nullptr if numBytes is larger than a region. The offset is a multiple of alignment,
+    // a power of two, and the memory is at least 16 byte aligned.
+    void* alloc(size_t numBytes, size_t& offset, size_t alignment = 16);
+
+    // Copies numBytes at offset, returned by alloc, into dstBufferId at dstOffset
+    void copyTo(GLuint dstBufferId, size_t dstOffset, size_t offset, size_t numBytes);
+
+    // Fences the current region and moves on. Call once per frame, after the commands which read the frame's data.
+    void nextRegion();
+
+    // Number of times a region was still in use by the GPU when it came around again. If this climbs, the ring is too small.
+    size_t numStalls() const;
+
+private:
+    void waitForRegion(size_t region);
+
+    const size_t m_regionBytes, m_numRegions;
+    GLuint m_bufferId = 0;
+    char* m_pMapped = nullptr;
+    std::vector<char> m_staging;
+    std::vector<GLsync> m_fences;
+    size_t m_region = 0, m_regionUsed = 0;
+    size_t m_numStalls = 0;
+};
+
+inline bool StreamBuffer::isPersistent() const
+{
+    return m_pMapped != nullptr;
+}
+
+inline size_t StreamBuffer::regionBytes() const
+{
+    return m_regionBytes;
+}
+
+inline GLuint StreamBuffer::bufferId() const
+{
+    return m_bufferId;
+}
+
+inline size_t StreamBuffer::numStalls() const
+{
+    return m_numStalls;
+}
+
+}
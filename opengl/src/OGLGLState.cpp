@@ -0,0 +1,250 @@
+#include <OGLExtensions.h>
+
+using namespace OGL;
+
+namespace
+{
+    const GLuint UNKNOWN = 0xffffffff;
+
+    struct BufferBinding {
+        GLenum m_target;
+        GLuint m_buffer;
+    };
+
+    struct CapState {
+        GLenum m_cap;
+        int m_enabled; // -1 is unknown
+    };
+
+    struct Shadow {
+        BufferBinding m_buffers[6] = {
+            { GL_ARRAY_BUFFER, UNKNOWN },
+            { GL_ELEMENT_ARRAY_BUFFER, UNKNOWN }, // Part of the bound VAO
+            { GL_DRAW_INDIRECT_BUFFER, UNKNOWN },
+            { GL_COPY_READ_BUFFER, UNKNOWN },
+            { GL_COPY_WRITE_BUFFER, UNKNOWN },
+            { GL_UNIFORM_BUFFER, UNKNOWN },
+        };
+        CapState m_caps[5] = {
+            { GL_COLOR_MATERIAL, -1 },
+            { GL_CULL_FACE, -1 },
+            { GL_DEPTH_TEST, -1 },
+            { GL_BLEND, -1 },
+            { GL_LIGHTING, -1 },
+        };
+        GLuint m_vao = UNKNOWN;
+        GLuint m_program = UNKNOWN;
+        GLenum m_cullFace = UNKNOWN;
+        GLenum m_colorMaterialFace = UNKNOWN;
+        GLenum m_colorMaterialMode = UNKNOWN;
+    };
+
+    Shadow s_shadow;
+    Extensions::GLState::Counters s_counters;
+
+    BufferBinding* findBinding(GLenum target)
+    {
+        for (auto& binding : s_shadow.m_buffers) {
+            if (binding.m_target == target)
+                return &binding;
+        }
+        return nullptr;
+    }
+
+    CapState* findCap(GLenum cap)
+    {
+        for (auto& capState : s_shadow.m_caps) {
+            if (capState.m_cap == cap)
+                return &capState;
+        }
+        return nullptr;
+    }
+
+    // Returns true if the call can be skipped
+    template<class T>
+    bool isRedundant(const T& current, const T& requested)
+    {
+        if (current == requested) {
+            s_counters.m_filtered++;
+            return true;
+        }
+        s_counters.m_issued++;
+        return false;
+    }
+}
+
+void Extensions::GLState::bindBuffer(GLenum target, GLuint buffer)
+{
+    BufferBinding* pBinding = findBinding(target);
+    if (!pBinding) {
+        s_counters.m_issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+
+    if (isRedundant(pBinding->m_buffer, buffer))
+        return;
+
+    glBindBuffer(target, buffer);
+    pBinding->m_buffer = buffer;
+}
+
+void Extensions::GLState::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    // Indexed bindings aren't tracked, the ranges normally move every frame
+    s_counters.m_issued++;
+    glBindBufferRange(target, index, buffer, offset, size);
+
+    BufferBinding* pBinding = findBinding(target);
+    if (pBinding)
+        pBinding->m_buffer = buffer;
+}
+
+void Extensions::GLState::bindVertexArray(GLuint vao)
+{
+    if (isRedundant(s_shadow.m_vao, vao))
+        return;
+
+    glBindVertexArray(vao);
+    s_shadow.m_vao = vao;
+
+    // Each VAO has its own element buffer binding
+    findBinding(GL_ELEMENT_ARRAY_BUFFER)->m_buffer = UNKNOWN;
+}
+
+void Extensions::GLState::useProgram(GLuint program)
+{
+    if (isRedundant(s_shadow.m_program, program))
+        return;
+
+    glUseProgram(program);
+    s_shadow.m_program = program;
+}
+
+void Extensions::GLState::deleteBuffers(GLsizei n, const GLuint* pBuffers)
+{
+    glDeleteBuffers(n, pBuffers);
+
+    // Deleting a bound buffer reverts the binding to zero
+    for (GLsizei i = 0; i < n; i++) {
+        for (auto& binding : s_shadow.m_buffers) {
+            if (binding.m_buffer == pBuffers[i])
+                binding.m_buffer = 0;
+        }
+    }
+}
+
+void Extensions::GLState::deleteVertexArrays(GLsizei n, const GLuint* pArrays)
+{
+    glDeleteVertexArrays(n, pArrays);
+
+    for (GLsizei i = 0; i < n; i++) {
+        if (s_shadow.m_vao == pArrays[i]) {
+            s_shadow.m_vao = 0;
+            findBinding(GL_ELEMENT_ARRAY_BUFFER)->m_buffer = UNKNOWN;
+        }
+    }
+}
+
+void Extensions::GLState::setEnabled(GLenum cap, bool enabled)
+{
+    CapState* pCap = findCap(cap);
+    if (pCap && isRedundant(pCap->m_enabled, enabled ? 1 : 0))
+        return;
+    if (!pCap)
+        s_counters.m_issued++;
+
+    if (enabled)
+        glEnable(cap);
+    else
+        glDisable(cap);
+
+    if (pCap)
+        pCap->m_enabled = enabled ? 1 : 0;
+}
+
+bool Extensions::GLState::isEnabled(GLenum cap)
+{
+    CapState* pCap = findCap(cap);
+    if (pCap && pCap->m_enabled != -1)
+        return pCap->m_enabled == 1;
+
+    s_counters.m_queries++;
+    bool enabled = glIsEnabled(cap) == GL_TRUE;
+    if (pCap)
+        pCap->m_enabled = enabled ? 1 : 0;
+
+    return enabled;
+}
+
+void Extensions::GLState::cullFace(GLenum mode)
+{
+    if (isRedundant(s_shadow.m_cullFace, mode))
+        return;
+
+    glCullFace(mode);
+    s_shadow.m_cullFace = mode;
+}
+
+GLenum Extensions::GLState::getCullFace()
+{
+    if (s_shadow.m_cullFace == UNKNOWN) {
+        s_counters.m_queries++;
+        GLint mode = GL_BACK;
+        glGetIntegerv(GL_CULL_FACE_MODE, &mode);
+        s_shadow.m_cullFace = mode;
+    }
+
+    return s_shadow.m_cullFace;
+}
+
+void Extensions::GLState::colorMaterial(GLenum face, GLenum mode)
+{
+    if (s_shadow.m_colorMaterialFace == face && s_shadow.m_colorMaterialMode == mode) {
+        s_counters.m_filtered++;
+        return;
+    }
+
+    s_counters.m_issued++;
+    glColorMaterial(face, mode);
+    s_shadow.m_colorMaterialFace = face;
+    s_shadow.m_colorMaterialMode = mode;
+}
+
+void Extensions::GLState::getColorMaterial(GLenum& face, GLenum& mode)
+{
+    if (s_shadow.m_colorMaterialFace == UNKNOWN || s_shadow.m_colorMaterialMode == UNKNOWN) {
+        s_counters.m_queries++;
+        GLint value = GL_FRONT_AND_BACK;
+        glGetIntegerv(GL_COLOR_MATERIAL_FACE, &value);
+        s_shadow.m_colorMaterialFace = value;
+
+        value = GL_AMBIENT_AND_DIFFUSE;
+        glGetIntegerv(GL_COLOR_MATERIAL_PARAMETER, &value);
+        s_shadow.m_colorMaterialMode = value;
+    }
+
+    face = s_shadow.m_colorMaterialFace;
+    mode = s_shadow.m_colorMaterialMode;
+}
+
+void Extensions::GLState::invalidate()
+{
+    s_shadow = Shadow();
+}
+
+void Extensions::GLState::invalidateVertexArrayState()
+{
+    findBinding(GL_ARRAY_BUFFER)->m_buffer = UNKNOWN;
+    findBinding(GL_ELEMENT_ARRAY_BUFFER)->m_buffer = UNKNOWN;
+}
+
+const Extensions::GLState::Counters& Extensions::GLState::getCounters()
+{
+    return s_counters;
+}
+
+void Extensions::GLState::resetCounters()
+{
+    s_counters = Counters();
+}
@@ -2,9 +2,11 @@
 #include <sstream>
 #include <iostream>
 #include <assert.h>
+#include <string.h>
 
 #include <OGLMultiVboHandler.h>
 #include <OGLShader.h>
+#include <OGLStreamBuffer.h>
 
 #ifdef WIN32
 #include <Windows.h>
@@ -136,10 +138,10 @@ ElementVBORec& ElementVBORec::operator = (const ElementVBORec& src)
 void ElementVBORec::bind(const std::vector<unsigned int>& indices)
 {
     m_mumElements = indices.size();
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementIdxVboID);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementIdxVboID);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_mumElements * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
 }
 
@@ -160,9 +162,20 @@ void MultiVBO::releaseVBOs()
     releaseVBO(m_colorVboID, m_valid);
     releaseVBO(m_backColorVboID, m_valid);
     releaseVBO(m_regionalNormalVboID, m_valid);
+    releaseVBO(m_indirectElementVboID, m_valid);
+    releaseVBO(m_indirectCommandVboID, m_valid);
+    m_numIndirectDraws = 0;
     m_elementVBOIDMap.clear();
 
+    if (m_vaoID) {
+        GLState::deleteVertexArrays(1, &m_vaoID);
+        m_vaoID = 0;
+    }
+    m_vaoDirty = true;
+    m_vaoBound = false;
+
     m_numVerts = 0;
+    m_layout = VertexLayout();
     m_valid = VBO_VALID_UNKNOWN;
 }
 
@@ -179,6 +192,8 @@ bool MultiVBO::isInitialized() const
         return false;
 #endif
 
+    if (m_layout.isInterleaved())
+        return glIsBuffer(m_vertexVboID);
     return glIsBuffer(m_vertexVboID) && glIsBuffer(m_normalVboID);
 }
 
@@ -221,7 +236,7 @@ void MultiVBO::releaseVBO(GLuint& vboID, int& valid)
     if (vboID)
     {
         if (isValid_unbindsVBO(vboID)) {
-            glDeleteBuffers(1, &vboID); 
+            GLState::deleteBuffers(1, &vboID); 
 
             HLOG(Format(_T("MultiVBO::releaseVBO: deleted buffer %d"), vboID));
         }
@@ -237,15 +252,62 @@ void MultiVBO::releaseVBO(GLuint& vboID, int& valid)
 bool MultiVBO::isValid_unbindsVBO(GLuint& vboID)
 {
     if (vboID) {
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, vboID);
         if (glIsBuffer(vboID)) {
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
             return true;
         }
     }
     return false;
 }
 
+bool MultiVBO::isVertexArraySupported()
+{
+    static int supported = -1;
+    if (supported == -1) {
+#ifdef WIN32
+        if (!hasVBOSupport() || !glGenVertexArrays || !glBindVertexArray || !glDeleteVertexArrays) {
+            supported = 0;
+            return false;
+        }
+#endif
+        GLint major = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        supported = major >= 3 ? 1 : 0;
+    }
+    return supported == 1;
+}
+
+bool MultiVBO::isMultiDrawIndirectSupported()
+{
+    static int supported = -1;
+    if (supported == -1) {
+        supported = 0;
+#ifdef WIN32
+        if (!glMultiDrawElementsIndirect || !glGetStringi)
+            return false;
+#endif
+        if (!isVertexArraySupported())
+            return false;
+
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        if (major > 4 || (major == 4 && minor >= 3))
+            supported = 1;
+        else {
+            GLint numExtensions = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+            for (GLint i = 0; i < numExtensions && !supported; i++) {
+                const char* pName = (const char*)glGetStringi(GL_EXTENSIONS, i);
+                if (pName && strcmp(pName, "GL_ARB_multi_draw_indirect") == 0)
+                    supported = 1;
+            }
+        }
+    }
+    return supported == 1;
+}
+
 bool MultiVBO::copyToVBO(const vector<float>& verts, const vector<float>& colors, int dataID)
 {
     m_valid = VBO_VALID_UNKNOWN;
@@ -281,6 +343,9 @@ bool MultiVBO::copyToVBO(const vector<float>& verts, const vector<float>& normal
     size_t size = verts.size();
     assert(!(size % 3)); //size should be multiple of 3 
 
+    m_layout = VertexLayout();
+    m_vaoDirty = true;
+
     bool vboValid1 = assureVBOValid(verts, m_vertexVboID, m_valid);
     bool vboValid2 = normals.empty() || assureVBOValid(normals, m_normalVboID, m_valid);
     bool vboValid3 = textureCoords.empty() || assureVBOValid(textureCoords, m_textureVboID, m_valid);
@@ -294,14 +359,14 @@ bool MultiVBO::copyToVBO(const vector<float>& verts, const vector<float>& normal
 
     m_numVerts = size / 3;
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);
     glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), verts.data(), GL_STATIC_DRAW);  
     HLOG(Format(_T("Copied %.1f MB to vbo %d"), size * sizeof(float) / 1048576.0f, m_vertexVboID));
 
     if (m_primitiveType == GL_TRIANGLES) {
         if (m_normalVboID)
         {
-            glBindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
+            GLState::bindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
             glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), normals.data(), GL_STATIC_DRAW);  
             HLOG(Format(_T("Copied %.1f MB to vbo %d"), size * sizeof(float) / 1048576.0f, m_normalVboID));
         }
@@ -310,30 +375,146 @@ bool MultiVBO::copyToVBO(const vector<float>& verts, const vector<float>& normal
 
     if (!colors.empty())
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_colorVboID);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_colorVboID);
         glBufferData(GL_ARRAY_BUFFER, (m_numVerts * 3 * sizeof(float)), colors.data(), GL_STATIC_DRAW); 
         HLOG(Format(_T("Copied %.1f MB to vbo %d"), (m_numVerts * 3 * sizeof(float)) / 1048576.0f, m_colorVboID));
     }
 
     if (!textureCoords.empty())
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_textureVboID);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_textureVboID);
         glBufferData(GL_ARRAY_BUFFER, (m_numVerts * 2 * sizeof(float)), textureCoords.data(), GL_STATIC_DRAW); 
         HLOG(Format(_T("Copied %.1f MB to vbo %d"), (m_numVerts * 2 * sizeof(float)) / 1048576.0f, m_textureVboID));
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);   
 
     m_dataID = id;
 
     return true;
 }
 
+bool MultiVBO::copyRangeToExistingVBO(size_t firstVert, size_t numVerts, const vector<float>& verts, const vector<float>& normals, bool smoothNrmls,
+    const vector<float>& textureCoords, const vector<float>& colors)
+{
+#ifdef WIN32
+    if (!hasVBOSupport() || !wglGetCurrentContext())
+        return false;
+#endif
+
+    if (m_layout.isInterleaved() || !m_vertexVboID || m_numVerts * 3 != verts.size() || firstVert + numVerts > m_numVerts)
+        return false;
+
+    // An array which was empty at the last copyToVBO has no VBO, and one which is empty now would have its VBO deleted
+    bool useNormals = m_primitiveType == GL_TRIANGLES;
+    if ((normals.empty() != (m_normalVboID == 0)) || (textureCoords.empty() != (m_textureVboID == 0)) || (colors.empty() != (m_colorVboID == 0)))
+        return false;
+    if ((useNormals && !normals.empty() && normals.size() != verts.size()) ||
+        (!textureCoords.empty() && textureCoords.size() < m_numVerts * 2) || (!colors.empty() && colors.size() < m_numVerts * 3))
+        return false;
+
+    m_valid = VBO_VALID_UNKNOWN;
+
+    copySubData(m_vertexVboID, firstVert * 3 * sizeof(float), numVerts * 3 * sizeof(float), verts.data() + firstVert * 3);
+
+    if (useNormals && m_normalVboID)
+        copySubData(m_normalVboID, firstVert * 3 * sizeof(float), numVerts * 3 * sizeof(float), normals.data() + firstVert * 3);
+    m_smoothNormals = smoothNrmls;
+
+    if (!colors.empty())
+        copySubData(m_colorVboID, firstVert * 3 * sizeof(float), numVerts * 3 * sizeof(float), colors.data() + firstVert * 3);
+
+    if (!textureCoords.empty())
+        copySubData(m_textureVboID, firstVert * 2 * sizeof(float), numVerts * 2 * sizeof(float), textureCoords.data() + firstVert * 2);
+
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return true;
+}
+
+bool MultiVBO::copyInterleavedToVBO(const vector<float>& data, const VertexLayout& layout, bool smoothNrmls, int id)
+{
+    m_valid = VBO_VALID_UNKNOWN;
+#ifdef WIN32
+    if (!hasVBOSupport() || !wglGetCurrentContext())
+        return false;
+#endif
+
+    assert(layout.isValid());
+    assert(!data.empty());
+    size_t floatsPerVert = layout.floatsPerVertex();
+    assert(!(data.size() % floatsPerVert));
+
+    // Everything lives in the vertex buffer, drop any separate buffers left from a prior copyToVBO
+    vector<float> empty;
+    assureVBOValid(empty, m_normalVboID, m_valid);
+    assureVBOValid(empty, m_textureVboID, m_valid);
+    assureVBOValid(empty, m_colorVboID, m_valid);
+    if (!assureVBOValid(data, m_vertexVboID, m_valid)) {
+        releaseVBOs();
+        return false;
+    }
+
+    m_layout = layout;
+    m_vaoDirty = true;
+    m_numVerts = data.size() / floatsPerVert;
+
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+    HLOG(Format(_T("Copied %.1f MB to vbo %d"), data.size() * sizeof(float) / 1048576.0f, m_vertexVboID));
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_smoothNormals = smoothNrmls;
+    m_dataID = id;
+
+    return true;
+}
+
+bool MultiVBO::copyInterleavedRangeToExistingVBO(size_t firstVert, size_t numVerts, const vector<float>& data, bool smoothNrmls)
+{
+#ifdef WIN32
+    if (!hasVBOSupport() || !wglGetCurrentContext())
+        return false;
+#endif
+
+    if (!m_layout.isInterleaved() || !m_vertexVboID || m_numVerts * m_layout.floatsPerVertex() != data.size() || firstVert + numVerts > m_numVerts)
+        return false;
+
+    m_valid = VBO_VALID_UNKNOWN;
+
+    copySubData(m_vertexVboID, firstVert * m_layout.m_stride, numVerts * m_layout.m_stride, data.data() + firstVert * m_layout.floatsPerVertex());
+    m_smoothNormals = smoothNrmls;
+
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return true;
+}
+
+void MultiVBO::setStreamBuffer(StreamBuffer* pStreamBuffer)
+{
+    m_pStreamBuffer = pStreamBuffer;
+}
+
+void MultiVBO::copySubData(GLuint vboID, size_t dstOffset, size_t numBytes, const void* pSrc)
+{
+    size_t offset;
+    void* pDst = m_pStreamBuffer ? m_pStreamBuffer->alloc(numBytes, offset) : nullptr;
+    if (pDst) {
+        // The handler's arrays are the source of truth, so the data is staged rather than packed straight into the ring
+        memcpy(pDst, pSrc, numBytes);
+        m_pStreamBuffer->copyTo(vboID, dstOffset, offset, numBytes);
+    } else {
+        // No stream buffer, or the range is larger than one of its regions
+        GLState::bindBuffer(GL_ARRAY_BUFFER, vboID);
+        glBufferSubData(GL_ARRAY_BUFFER, dstOffset, numBytes, pSrc);
+    }
+}
+
 bool MultiVBO::copyVertecesToExistingVBO(const vector<float>& verts)
 {
     m_valid = VBO_VALID_UNKNOWN;
     size_t numFloats = verts.size();
-    if (m_numVerts * 3 != numFloats)
+    if (m_layout.isInterleaved() || m_numVerts * 3 != numFloats)
     {
         assert(!"vbo array size mismatch");
         return false;
@@ -345,10 +526,10 @@ bool MultiVBO::copyVertecesToExistingVBO(const vector<float>& verts)
         return false;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);
     glBufferData(GL_ARRAY_BUFFER, numFloats * sizeof(float), verts.data(), GL_STATIC_DRAW);  
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);   
 
     return true;
 }
@@ -357,7 +538,7 @@ bool MultiVBO::copyNormalsToExistingVBO(const vector<float>& normals, bool smoot
 {
     m_valid = VBO_VALID_UNKNOWN;
     size_t numFloats = normals.size();
-    if (m_numVerts * 3 != numFloats)
+    if (m_layout.isInterleaved() || m_numVerts * 3 != numFloats)
     {
         assert(!"vbo array size mismatch");
         return false;
@@ -369,11 +550,11 @@ bool MultiVBO::copyNormalsToExistingVBO(const vector<float>& normals, bool smoot
         return false;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
     glBufferData(GL_ARRAY_BUFFER, numFloats * sizeof(float), normals.data(), GL_STATIC_DRAW);  
     m_smoothNormals = smooth;
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);   
 
     return true;
 }
@@ -381,7 +562,9 @@ bool MultiVBO::copyNormalsToExistingVBO(const vector<float>& normals, bool smoot
 bool MultiVBO::reverseNormals()
 {
     m_valid = VBO_VALID_UNKNOWN;
-    glBindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
+    if (!m_normalVboID)
+        return false;
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_normalVboID);
     GLint size;
     glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
     vector<unsigned char> buf;
@@ -393,14 +576,14 @@ bool MultiVBO::reverseNormals()
         pv[i] = -pv[i];
 
     glBufferSubData(GL_ARRAY_BUFFER, 0, size, &buf[0]);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
     return true;
 }
 
 bool MultiVBO::copyColorsToExistingVBO(const vector<float>& colors)
 {
     m_valid = VBO_VALID_UNKNOWN;
-    if (m_numVerts != colors.size())
+    if (m_layout.isInterleaved() || m_numVerts != colors.size())
     {
         assert(!"vbo array size mismatch");
         return false;
@@ -409,12 +592,13 @@ bool MultiVBO::copyColorsToExistingVBO(const vector<float>& colors)
     if (!m_colorVboID)
     {
         createVBO(m_colorVboID, m_valid);
+        m_vaoDirty = true;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_colorVboID);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_colorVboID);   
     glBufferData(GL_ARRAY_BUFFER, (m_numVerts * sizeof(float)), colors.data(), GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);   
 
     return true;
 }
@@ -433,10 +617,10 @@ bool MultiVBO::copyBackColorsToExistingVBO(const vector<float>& backColors)
         createVBO(m_backColorVboID, m_valid);
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);   
     glBufferData(GL_ARRAY_BUFFER, (m_numVerts * sizeof(unsigned int)), backColors.data(), GL_STATIC_DRAW);  
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);   
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);   
 
     return true;
 }
@@ -444,6 +628,11 @@ bool MultiVBO::copyBackColorsToExistingVBO(const vector<float>& backColors)
 void MultiVBO::setUseSmoothNormal(bool set)
 {
     m_valid = VBO_VALID_UNKNOWN;
+    if (m_layout.isInterleaved() && m_layout.m_normalOffset != -1) {
+        m_smoothNormals = set;
+        return;
+    }
+
     if (!m_normalVboID || !glIsBuffer(m_normalVboID))
     {
         // actually we could just create it here instead
@@ -469,7 +658,7 @@ void MultiVBO::setUseRegionalNormal(bool set)
     {
         createVBO(m_regionalNormalVboID, m_valid);
 
-        glBindBuffer(GL_ARRAY_BUFFER, m_regionalNormalVboID);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_regionalNormalVboID);
         glBufferData(GL_ARRAY_BUFFER, m_numVerts * 3 * sizeof(float), 0, GL_STATIC_DRAW);  
     }
 }
@@ -569,22 +758,121 @@ bool MultiVBO::areVBOsValid(size_t numElements, GLuint elementIdxVboID, DrawVert
 
 bool MultiVBO::bindCommon(const ShaderBase* pShader, size_t numElements) const
 {
+    if (isVertexArraySupported()) {
+        bindVertexArray(pShader);
+        m_vaoBound = true;
+        return true;
+    }
+
+    return bindAttributes(pShader);
+}
+
+void MultiVBO::unbindCommon() const
+{
+    if (m_vaoBound) {
+        GLState::bindVertexArray(0); GL_ASSERT;
+        m_vaoBound = false;
+        return;
+    }
+
+    unbindAttributes();
+}
+
+void MultiVBO::bindVertexArray(const ShaderBase* pShader) const
+{
+    const GLuint locs[] = { pShader->getVertexLoc(), pShader->getNormalLoc(), pShader->getTexParamLoc(), pShader->getColorLoc() };
+    if (!m_vaoID) {
+        glGenVertexArrays(1, &m_vaoID); GL_ASSERT;
+        m_vaoDirty = true;
+    }
+
+    GLState::bindVertexArray(m_vaoID); GL_ASSERT;
+    if (m_vaoDirty || memcmp(locs, m_vaoLocs, sizeof(locs)) != 0) {
+        // Record the attribute setup. Arrays enabled for a prior shader's locations must not stay enabled.
+        for (GLuint loc : m_vaoLocs) {
+            if (loc != GLuint(-1)) {
+                glDisableVertexAttribArray(loc); GL_ASSERT;
+            }
+        }
+        bindAttributes(pShader);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, 0); GL_ASSERT;
+
+        memcpy(m_vaoLocs, locs, sizeof(locs));
+        m_vaoColorMode = DRAW_COLOR_NONE;
+        m_vaoDirty = false;
+    }
+}
+
+void MultiVBO::setVertexArrayColors(const ShaderBase* pShader, DrawVertexColorMode drawColors) const
+{
+    GLuint colorLoc = pShader->getColorLoc();
+    DrawVertexColorMode mode = DRAW_COLOR_NONE;
+    if (colorLoc != GLuint(-1)) {
+        if (drawColors == DRAW_COLOR && hasColorData())
+            mode = DRAW_COLOR;
+        else if (drawColors == DRAW_COLOR_BACK && m_backColorVboID)
+            mode = DRAW_COLOR_BACK;
+    }
+
+    // The color array is part of the VAO, only change it when switching between front, back and no colors
+    if (mode == m_vaoColorMode)
+        return;
+
+    if (mode == DRAW_COLOR_NONE) {
+        glDisableVertexAttribArray(colorLoc); GL_ASSERT;
+    } else {
+        if (mode == DRAW_COLOR && m_layout.isInterleaved()) {
+            GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID); GL_ASSERT;
+            glVertexAttribPointer(colorLoc, VertexLayout::attribSize(m_layout.m_colorType, 3), m_layout.m_colorType, m_layout.m_colorType != GL_FLOAT,
+                m_layout.m_stride, (const void*)(size_t)m_layout.m_colorOffset); GL_ASSERT;
+        } else {
+            GLState::bindBuffer(GL_ARRAY_BUFFER, mode == DRAW_COLOR ? m_colorVboID : m_backColorVboID); GL_ASSERT;
+            glVertexAttribPointer(colorLoc, 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
+        }
+        glEnableVertexAttribArray(colorLoc); GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, 0); GL_ASSERT;
+    }
+    m_vaoColorMode = mode;
+}
+
+bool MultiVBO::bindAttributes(const ShaderBase* pShader) const
+{
+    if (m_layout.isInterleaved()) {
+        // One bind, every attribute reads from the same buffer at its own offset
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);       GL_ASSERT;
+        glEnableVertexAttribArray(pShader->getVertexLoc()); GL_ASSERT;
+        glVertexAttribPointer(pShader->getVertexLoc(), 3, GL_FLOAT, 0, m_layout.m_stride, (const void*)(size_t)m_layout.m_positionOffset); GL_ASSERT;
+
+        if (m_layout.m_normalOffset != -1) {
+            glEnableVertexAttribArray(pShader->getNormalLoc()); GL_ASSERT;
+            glVertexAttribPointer(pShader->getNormalLoc(), VertexLayout::attribSize(m_layout.m_normalType, 3), m_layout.m_normalType, m_layout.m_normalType != GL_FLOAT,
+                m_layout.m_stride, (const void*)(size_t)m_layout.m_normalOffset); GL_ASSERT;
+        }
+
+        if (m_layout.m_texCoordOffset != -1 && pShader->getTexParamLoc() != -1) {
+            glEnableVertexAttribArray(pShader->getTexParamLoc()); GL_ASSERT;
+            glVertexAttribPointer(pShader->getTexParamLoc(), 2, m_layout.m_texCoordType, 0, m_layout.m_stride, (const void*)(size_t)m_layout.m_texCoordOffset); GL_ASSERT;
+        }
+
+        return true;
+    }
+
     //bind the verteces
-    glBindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);       GL_ASSERT;
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);       GL_ASSERT;
     glEnableVertexAttribArray(pShader->getVertexLoc()); GL_ASSERT;
     glVertexAttribPointer(pShader->getVertexLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
 
     //bind the normals
     if (m_normalVboID)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_normalVboID);      GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_normalVboID);      GL_ASSERT;
         glEnableVertexAttribArray(pShader->getNormalLoc()); GL_ASSERT;
         glVertexAttribPointer(pShader->getNormalLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
     }
 
     if (m_textureVboID && pShader->getTexParamLoc() != -1)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_textureVboID);   GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_textureVboID);   GL_ASSERT;
         glEnableVertexAttribArray(pShader->getTexParamLoc()); GL_ASSERT;
         glVertexAttribPointer(pShader->getTexParamLoc(), 2, GL_FLOAT, 0, 0, 0); GL_ASSERT;
     }
@@ -592,7 +880,7 @@ bool MultiVBO::bindCommon(const ShaderBase* pShader, size_t numElements) const
     return true;
 }
 
-void MultiVBO::unbindCommon() const
+void MultiVBO::unbindAttributes() const
 {
     // revert state
     glDisableClientState(GL_VERTEX_ARRAY);            GL_ASSERT;
@@ -604,7 +892,7 @@ void MultiVBO::unbindCommon() const
         glDisableClientState(GL_TEXTURE_COORD_ARRAY); GL_ASSERT;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);  GL_ASSERT;
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);  GL_ASSERT;
 }
 
 template<class T>
@@ -612,7 +900,7 @@ inline bool MultiVBO::assureVBOValid(const vector<T>& vec, GLuint& vboID, int& v
 {
     if (vboID) {
         if (vec.empty()) {
-            glDeleteBuffers(1, &vboID); 
+            GLState::deleteBuffers(1, &vboID); 
             vboID = 0;
             return true;
         }
@@ -633,23 +921,31 @@ bool MultiVBO::drawVBOIndexVBO(const ShaderBase* pShader, GLsizei numElements, G
     if (drawColors == DRAW_COLOR_SKIP)
         return true;
 
+    if (isVertexArraySupported())
+        return drawVBOIndexVAO(pShader, numElements, elementIdxVboID, drawColors);
+
     bool drawingColors = false;
     int priorCulling = -1;
 
-    glPushAttrib(GL_ALL_ATTRIB_BITS);                GL_ASSERT;
+    // glPushAttrib(GL_ALL_ATTRIB_BITS) is costly, the little server state changed here is restored from the GLState shadow instead
     glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT); GL_ASSERT;
+    bool priorColorMaterial = GLState::isEnabled(GL_COLOR_MATERIAL);
+    GLenum priorColorMaterialFace, priorColorMaterialMode;
+    GLState::getColorMaterial(priorColorMaterialFace, priorColorMaterialMode);
 
     // Enable vertex and normal arrays
-    if (!areVBOsValid(numElements, elementIdxVboID, drawColors) || !bindCommon(pShader, numElements)) {
+    if (!areVBOsValid(numElements, elementIdxVboID, drawColors) || !bindAttributes(pShader)) {
         assert(!"MultiVBO not valid");
         areVBOsValid(numElements, elementIdxVboID, drawColors); GL_ASSERT;
-        bindCommon(pShader, numElements); GL_ASSERT;
+        bindAttributes(pShader); GL_ASSERT;
+        glPopClientAttrib();
+        GLState::invalidateVertexArrayState();
         return false;
     }
 
-    if (m_colorVboID && drawColors == DRAW_COLOR) {
-        glEnable(GL_COLOR_MATERIAL); GL_ASSERT;
-        glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE); GL_ASSERT;
+    if (hasColorData() && drawColors == DRAW_COLOR) {
+        GLState::setEnabled(GL_COLOR_MATERIAL, true); GL_ASSERT;
+        GLState::colorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE); GL_ASSERT;
         glEnableClientState(GL_COLOR_ARRAY); GL_ASSERT;
         glEnableVertexAttribArray(pShader->getColorLoc()); GL_ASSERT;
         glVertexAttribPointer(pShader->getColorLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
@@ -665,18 +961,24 @@ bool MultiVBO::drawVBOIndexVBO(const ShaderBase* pShader, GLsizei numElements, G
     }
 #endif
 
-    if (drawColors == DRAW_COLOR && m_colorVboID && pShader->getColorLoc() != -1)
+    if (drawColors == DRAW_COLOR && hasColorData() && pShader->getColorLoc() != -1)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_colorVboID);     GL_ASSERT;
-        glVertexAttribPointer(pShader->getColorLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
+        if (m_layout.isInterleaved()) {
+            GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);     GL_ASSERT;
+            glVertexAttribPointer(pShader->getColorLoc(), VertexLayout::attribSize(m_layout.m_colorType, 3), m_layout.m_colorType, m_layout.m_colorType != GL_FLOAT,
+                m_layout.m_stride, (const void*)(size_t)m_layout.m_colorOffset); GL_ASSERT;
+        } else {
+            GLState::bindBuffer(GL_ARRAY_BUFFER, m_colorVboID);     GL_ASSERT;
+            glVertexAttribPointer(pShader->getColorLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
+        }
 
         drawingColors = true;
     }
     else if (drawColors == DRAW_COLOR_BACK && m_backColorVboID && pShader->getColorLoc() != -1)
     {
-        glGetIntegerv(GL_CULL_FACE_MODE, &priorCulling); GL_ASSERT;
-        glCullFace(GL_BACK); GL_ASSERT;
-        glBindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);     GL_ASSERT;
+        priorCulling = GLState::getCullFace();
+        GLState::cullFace(GL_BACK); GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);     GL_ASSERT;
         glVertexAttribPointer(pShader->getColorLoc(), 3, GL_FLOAT, 0, 0, 0); GL_ASSERT;
 
         drawingColors = true;
@@ -685,25 +987,148 @@ bool MultiVBO::drawVBOIndexVBO(const ShaderBase* pShader, GLsizei numElements, G
     // Render the triangles
     if (numElements && (m_primitiveType == GL_TRIANGLES || m_primitiveType == GL_QUADS || m_primitiveType == GL_LINES || m_primitiveType == GL_LINE_STRIP))
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementIdxVboID);       GL_ASSERT;
+        GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementIdxVboID);       GL_ASSERT;
         glDrawElements(m_primitiveType, numElements, GL_UNSIGNED_INT, 0); GL_ASSERT;
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); GL_ASSERT;
     }
     else
     {
         glDrawArrays(m_primitiveType, 0, (GLsizei)m_numVerts);      GL_ASSERT;
     }
 
-    unbindCommon();
+    unbindAttributes();
 
     if (drawingColors)
         glDisableClientState(GL_COLOR_ARRAY);
 
     if (priorCulling != -1)
-        glCullFace(priorCulling);
+        GLState::cullFace(priorCulling);
+
+    GLState::setEnabled(GL_COLOR_MATERIAL, priorColorMaterial);
+    GLState::colorMaterial(priorColorMaterialFace, priorColorMaterialMode);
 
-    glPopAttrib();
     glPopClientAttrib();                                GL_ASSERT;
+    GLState::invalidateVertexArrayState();
+
+    return true;
+}
+
+bool MultiVBO::drawVBOIndexVAO(const ShaderBase* pShader, GLsizei numElements, GLuint elementIdxVboID, DrawVertexColorMode drawColors) const
+{
+    if (!areVBOsValid(numElements, elementIdxVboID, drawColors)) {
+        assert(!"MultiVBO not valid");
+        return false;
+    }
+
+    // Inside bindCommon/unbindCommon the VAO is already bound, otherwise bind it for just this draw
+    bool wasBound = m_vaoBound;
+    if (!wasBound)
+        bindVertexArray(pShader);
+
+    setVertexArrayColors(pShader, drawColors);
+
+    int priorCulling = -1;
+    if (m_vaoColorMode == DRAW_COLOR_BACK) {
+        priorCulling = GLState::getCullFace();
+        GLState::cullFace(GL_BACK); GL_ASSERT;
+    }
+
+    // The element buffer binding is VAO state, it doesn't need to be cleared afterwards
+    if (numElements && (m_primitiveType == GL_TRIANGLES || m_primitiveType == GL_QUADS || m_primitiveType == GL_LINES || m_primitiveType == GL_LINE_STRIP))
+    {
+        GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementIdxVboID);       GL_ASSERT;
+        glDrawElements(m_primitiveType, numElements, GL_UNSIGNED_INT, 0); GL_ASSERT;
+    }
+    else
+    {
+        glDrawArrays(m_primitiveType, 0, (GLsizei)m_numVerts);      GL_ASSERT;
+    }
+
+    if (priorCulling != -1)
+        GLState::cullFace(priorCulling);
+
+    if (!wasBound) {
+        GLState::bindVertexArray(0); GL_ASSERT;
+    }
+
+    return true;
+}
+
+bool MultiVBO::setIndirectDraws(const vector<const vector<unsigned int>*>& indexLists)
+{
+    // Layout fixed by the GL spec
+    struct DrawElementsIndirectCommand {
+        GLuint m_count;
+        GLuint m_instanceCount;
+        GLuint m_firstIndex;
+        GLint m_baseVertex;
+        GLuint m_baseInstance;
+    };
+
+    size_t numIndices = 0;
+    for (const auto pList : indexLists)
+        numIndices += pList->size();
+
+    vector<unsigned int> indices;
+    vector<DrawElementsIndirectCommand> commands;
+    indices.reserve(numIndices);
+    commands.reserve(indexLists.size());
+    for (const auto pList : indexLists) {
+        if (pList->empty())
+            continue;
+        commands.push_back({ (GLuint)pList->size(), 1, (GLuint)indices.size(), 0, 0 });
+        indices.insert(indices.end(), pList->begin(), pList->end());
+    }
+
+    m_numIndirectDraws = (GLsizei)commands.size();
+    if (commands.empty())
+        return true;
+
+    if ((!m_indirectElementVboID && !createVBO(m_indirectElementVboID, m_valid)) || (!m_indirectCommandVboID && !createVBO(m_indirectCommandVboID, m_valid))) {
+        m_numIndirectDraws = 0;
+        return false;
+    }
+
+    // Upload through the copy target, binding GL_ELEMENT_ARRAY_BUFFER would change whichever VAO is bound
+    GLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_indirectElementVboID); GL_ASSERT;
+    glBufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW); GL_ASSERT;
+    GLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_indirectCommandVboID); GL_ASSERT;
+    glBufferData(GL_COPY_WRITE_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STATIC_DRAW); GL_ASSERT;
+    GLState::bindBuffer(GL_COPY_WRITE_BUFFER, 0); GL_ASSERT;
+
+    return true;
+}
+
+bool MultiVBO::drawIndirect(const ShaderBase* pShader, DrawVertexColorMode drawColors) const
+{
+    if (drawColors == DRAW_COLOR_SKIP || m_numIndirectDraws == 0)
+        return true;
+
+    if (!isMultiDrawIndirectSupported() || !areVBOsValid(0, 0, drawColors))
+        return false;
+
+    bool wasBound = m_vaoBound;
+    if (!wasBound)
+        bindVertexArray(pShader);
+
+    setVertexArrayColors(pShader, drawColors);
+
+    int priorCulling = -1;
+    if (m_vaoColorMode == DRAW_COLOR_BACK) {
+        priorCulling = GLState::getCullFace();
+        GLState::cullFace(GL_BACK); GL_ASSERT;
+    }
+
+    GLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indirectElementVboID); GL_ASSERT;
+    GLState::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectCommandVboID); GL_ASSERT;
+    glMultiDrawElementsIndirect(m_primitiveType, GL_UNSIGNED_INT, nullptr, m_numIndirectDraws, 0); GL_ASSERT;
+    GLState::bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0); GL_ASSERT;
+
+    if (priorCulling != -1)
+        GLState::cullFace(priorCulling);
+
+    if (!wasBound) {
+        GLState::bindVertexArray(0); GL_ASSERT;
+    }
 
     return true;
 }
@@ -747,13 +1172,18 @@ bool MultiVBO::drawVBO(const ShaderBase* pShader, const vector<unsigned int>& in
             return false;
         m_valid = VBO_VALID_TRUE;
     }
-    glPushAttrib(GL_ALL_ATTRIB_BITS);                GL_ASSERT;
+
+    // This path uses the fixed function arrays, keep them out of the batch's VAO
+    if (m_vaoBound)
+        GLState::bindVertexArray(0);
+
     glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
 
     // Enable vertex and normal arrays
     glEnableClientState(GL_VERTEX_ARRAY);            GL_ASSERT;
 
-    if (m_normalVboID)
+    bool interleavedNormals = m_layout.isInterleaved() && m_layout.m_normalOffset != -1;
+    if (m_normalVboID || interleavedNormals)
         glEnableClientState(GL_NORMAL_ARRAY);
     if (m_textureVboID)
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -763,32 +1193,37 @@ bool MultiVBO::drawVBO(const ShaderBase* pShader, const vector<unsigned int>& in
     //bind the normals
     if (m_normalVboID)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_normalVboID);      GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_normalVboID);      GL_ASSERT;
         glNormalPointer(GL_FLOAT, 0, 0);
     }
 
     //bind the verteces
-    glBindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);       GL_ASSERT;
-    glVertexPointer(3, GL_FLOAT, 0, 0);
+    GLState::bindBuffer(GL_ARRAY_BUFFER, m_vertexVboID);       GL_ASSERT;
+    if (m_layout.isInterleaved()) {
+        glVertexPointer(3, GL_FLOAT, m_layout.m_stride, (const void*)(size_t)m_layout.m_positionOffset);
+        if (interleavedNormals)
+            glNormalPointer(m_layout.m_normalType, m_layout.m_stride, (const void*)(size_t)m_layout.m_normalOffset);
+    } else
+        glVertexPointer(3, GL_FLOAT, 0, 0);
 
     if (m_colorVboID && (drawColors == DRAW_COLOR))
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_colorVboID);     GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_colorVboID);     GL_ASSERT;
         glColorPointer(4, GL_UNSIGNED_BYTE, 0, 0);
     }
 
     else if (m_backColorVboID && (drawColors == DRAW_COLOR_BACK))
     {
-        glGetIntegerv(GL_CULL_FACE_MODE, &priorCulling);
-        glCullFace(GL_BACK);
-        glBindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);     GL_ASSERT;
+        priorCulling = GLState::getCullFace();
+        GLState::cullFace(GL_BACK);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_backColorVboID);     GL_ASSERT;
         glColorPointer(4, GL_UNSIGNED_BYTE, 0, 0);
     }
 
 #if 0
     if (m_textureVboID)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_textureVboID);   GL_ASSERT;
+        GLState::bindBuffer(GL_ARRAY_BUFFER, m_textureVboID);   GL_ASSERT;
         glTexCoordPointer(2, GL_FLOAT, 0, 0);
     }
 
@@ -807,20 +1242,23 @@ bool MultiVBO::drawVBO(const ShaderBase* pShader, const vector<unsigned int>& in
     // revert state
     glDisableClientState(GL_VERTEX_ARRAY);            GL_ASSERT;
 
-    if (m_normalVboID)
+    if (m_normalVboID || interleavedNormals)
         glDisableClientState(GL_NORMAL_ARRAY);
     if (m_textureVboID)
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     if (m_colorVboID)
         glDisableClientState(GL_COLOR_ARRAY);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);                  GL_ASSERT;
+    GLState::bindBuffer(GL_ARRAY_BUFFER, 0);                  GL_ASSERT;
 
     if (priorCulling != -1)
-        glCullFace(priorCulling);
+        GLState::cullFace(priorCulling);
 
-    glPopAttrib();
     glPopClientAttrib();                                GL_ASSERT;
+    GLState::invalidateVertexArrayState();
+
+    if (m_vaoBound)
+        GLState::bindVertexArray(m_vaoID);
 
     return true;
 }
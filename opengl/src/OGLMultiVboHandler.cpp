@@ -2,6 +2,10 @@
 #include <sstream>
 #include <assert.h>
 #include <set>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string.h>
 
 #include <OGLMultiVboHandler.h>
 
@@ -35,6 +39,9 @@ Another refinement is to our own vertex mangement using partial VBO writing to r
 #define OGL_FACE_BATCH_VERT_COUNT_MAX_K 128
 #define OGL_EDGE_BATCH_VERT_COUNT_MAX_K 16
 
+// Dirty vertex ranges closer than this are sent in one glBufferSubData call. Larger calls are cheaper than several tiny ones.
+#define OGL_DIRTY_RANGE_MERGE_GAP_VERTS 256
+
 using namespace std;
 using namespace OGL;
 
@@ -106,6 +113,20 @@ MultiVboHandler::~MultiVboHandler()
 {
 }
 
+void MultiVboHandler::setStreamBuffer(StreamBuffer* pStreamBuffer)
+{
+    m_pStreamBuffer = pStreamBuffer;
+    for (auto& batchPtr : m_batches)
+        batchPtr->m_VBO.setStreamBuffer(pStreamBuffer);
+}
+
+void MultiVboHandler::setVertexLayout(const VertexLayout& layout)
+{
+    assert(empty()); // Existing batches would have to be repacked
+    assert(layout.isValid());
+    m_layout = layout;
+}
+
 void MultiVboHandler::moveKeyToLayer(int key, int layer)
 {
     assert(layer > 0); // All keys are in layer zero by default. Placing a key from layer zero to layer zero is not valid.
@@ -119,12 +140,16 @@ void MultiVboHandler::moveKeyToLayer(int key, int layer)
     if (layer >= m_layersKeys.size())
         m_layersKeys.resize(layer + 1);
     m_layersKeys[layer].push_back(key);
+
+    for (auto& pBatch : m_batches)
+        pBatch->m_indirectDirty = true; // Draw order changed
 }
 
 void MultiVboHandler::clear()
 {
     for (auto batchPtr : m_batches) {
         batchPtr->m_VBO.releaseVBOs();
+        batchPtr->m_indirectDirty = true;
     }
     m_batches.clear();
 
@@ -202,45 +227,61 @@ void MultiVboHandler::setFaceTessellationInner(size_t batchIndex, size_t vertChu
     glIndicesOut.m_numVertsInBatch = numVerts;
 
     auto& batchPtr = m_batches[batchIndex];
-    batchPtr->m_needsUpdate = true;
-
-    size_t sizeRequred2 = 2 * (vertBaseIndex + numVerts);
-    size_t sizeRequred3 = 3 * (vertBaseIndex + numVerts);
+    markVertsDirty(*batchPtr, vertBaseIndex, numVerts);
 
-    // In the primary code path these arrays are always sized correctly, but during undo/redo there can be a mismatch. Resize everything if they're too small.
-    if (batchPtr->m_points.size() < sizeRequred3)
-        batchPtr->m_points.resize(sizeRequred3);
-    if (batchPtr->m_normals.size() < sizeRequred3)
-        batchPtr->m_normals.resize(sizeRequred3);
+    if (m_layout.isInterleaved()) {
+        size_t sizeRequired = m_layout.floatsPerVertex() * (vertBaseIndex + numVerts);
+        if (batchPtr->m_interleaved.size() < sizeRequired)
+            batchPtr->m_interleaved.resize(sizeRequired);
 
-    if (batchPtr->m_parameters.size() < sizeRequred2)
-        batchPtr->m_parameters.resize(sizeRequred2);
-
-    if (!colors.empty() && batchPtr->m_colors.size() < sizeRequred3)
-        batchPtr->m_colors.resize(sizeRequred3);
-
-    for (size_t vertIdx = 0; vertIdx < numVerts; vertIdx++) {
-        for (int j = 0; j < 3; j++) {
-            size_t dstIdx = 3 * (vertBaseIndex + vertIdx) + j;
-            size_t srcIdx = 3 * vertIdx + j;
-            batchPtr->m_points[dstIdx] = points[srcIdx];
-            batchPtr->m_normals[dstIdx] = normals[srcIdx];
-            if (!colors.empty())
-                batchPtr->m_colors[dstIdx] = colors[srcIdx];
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_positionOffset, GL_FLOAT, 3, points);
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_normalOffset, m_layout.m_normalType, 3, normals);
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_texCoordOffset, m_layout.m_texCoordType, 2, parameters);
+        if (!colors.empty()) {
+            writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_colorOffset, m_layout.m_colorType, 3, colors);
+        } else {
+            // The slot is drawn whenever the layout has colors, default to white rather than leaving it black
+            const float white[3] = { 1.0f, 1.0f, 1.0f };
+            writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_colorOffset, m_layout.m_colorType, 3, white, 0);
         }
+    } else {
+        size_t sizeRequred2 = 2 * (vertBaseIndex + numVerts);
+        size_t sizeRequred3 = 3 * (vertBaseIndex + numVerts);
+
+        // In the primary code path these arrays are always sized correctly, but during undo/redo there can be a mismatch. Resize everything if they're too small.
+        if (batchPtr->m_points.size() < sizeRequred3)
+            batchPtr->m_points.resize(sizeRequred3);
+        if (batchPtr->m_normals.size() < sizeRequred3)
+            batchPtr->m_normals.resize(sizeRequred3);
+
+        if (batchPtr->m_parameters.size() < sizeRequred2)
+            batchPtr->m_parameters.resize(sizeRequred2);
+
+        if (!colors.empty() && batchPtr->m_colors.size() < sizeRequred3)
+            batchPtr->m_colors.resize(sizeRequred3);
+
+        for (size_t vertIdx = 0; vertIdx < numVerts; vertIdx++) {
+            for (int j = 0; j < 3; j++) {
+                size_t dstIdx = 3 * (vertBaseIndex + vertIdx) + j;
+                size_t srcIdx = 3 * vertIdx + j;
+                batchPtr->m_points[dstIdx] = points[srcIdx];
+                batchPtr->m_normals[dstIdx] = normals[srcIdx];
+                if (!colors.empty())
+                    batchPtr->m_colors[dstIdx] = colors[srcIdx];
+            }
 
-        for (int j = 0; j < 2; j++) {
-            size_t dstIdx = 2 * (vertBaseIndex + vertIdx) + j;
-            size_t srcIdx = 2 * vertIdx + j;
-            batchPtr->m_parameters[dstIdx] = parameters[srcIdx];
+            for (int j = 0; j < 2; j++) {
+                size_t dstIdx = 2 * (vertBaseIndex + vertIdx) + j;
+                size_t srcIdx = 2 * vertIdx + j;
+                batchPtr->m_parameters[dstIdx] = parameters[srcIdx];
+            }
         }
     }
 
-    set<unsigned int> vertexIndexSet;
+    glIndicesOut.m_elementIndices.reserve(triIndices.size());
     for (size_t i = 0; i < triIndices.size(); i++) {
         unsigned int vertIndex = vertBaseIndex + triIndices[i];
         glIndicesOut.m_elementIndices.push_back(vertIndex);
-        vertexIndexSet.insert(vertIndex);
     }
 }
 
@@ -269,23 +310,275 @@ void MultiVboHandler::endFaceTesselation(bool smoothNormals)
     m_insideBeginFaceTessellation = false;
     for (size_t idx = 0; idx < m_batches.size(); idx++) {
         auto pBatch = m_batches[idx];
-        if (pBatch && pBatch->m_needsUpdate) {
-            pBatch->m_VBO.copyToVBO(pBatch->m_points, pBatch->m_normals, smoothNormals, pBatch->m_parameters, pBatch->m_colors);
-            pBatch->m_needsUpdate = false;
+        if (pBatch)
+            uploadBatch(*pBatch, smoothNormals);
+    }
+}
+
+size_t MultiVboHandler::batchCapacity(const VertexBatch& batch) const
+{
+    if (m_layout.isInterleaved())
+        return batch.m_interleaved.size() / m_layout.floatsPerVertex();
+    return batch.m_points.size() / 3;
+}
+
+namespace
+{
+    uint16_t floatToHalf(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        uint32_t sign = (bits >> 16) & 0x8000;
+        int32_t exp = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+        uint32_t mant = bits & 0x7fffff;
+
+        if (exp >= 31) // Too large, infinite or nan
+            return (uint16_t)(sign | 0x7c00 | ((((bits >> 23) & 0xff) == 0xff && mant) ? 0x200 : 0));
+
+        uint32_t half, rem, halfway;
+        if (exp <= 0) {
+            if (exp < -10)
+                return (uint16_t)sign;
+            // Denormal, shift in the implicit leading bit
+            mant |= 0x800000;
+            uint32_t shift = 14 - exp;
+            half = mant >> shift;
+            rem = mant & ((1u << shift) - 1);
+            halfway = 1u << (shift - 1);
+        } else {
+            half = (exp << 10) | (mant >> 13);
+            rem = mant & 0x1fff;
+            halfway = 0x1000;
+        }
+
+        // Round to nearest even. A carry out of the mantissa correctly bumps the exponent.
+        if (rem > halfway || (rem == halfway && (half & 1)))
+            half++;
+        return (uint16_t)(sign | half);
+    }
+
+    float halfToFloat(uint16_t half)
+    {
+        uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+        uint32_t exp = (half >> 10) & 0x1f;
+        uint32_t mant = half & 0x3ff;
+
+        uint32_t bits;
+        if (exp == 0x1f)
+            bits = sign | 0x7f800000 | (mant << 13);
+        else if (exp != 0)
+            bits = sign | ((exp + 112) << 23) | (mant << 13);
+        else if (mant == 0)
+            bits = sign;
+        else {
+            // Denormal half is a normal float
+            exp = 113;
+            while (!(mant & 0x400)) {
+                mant <<= 1;
+                exp--;
+            }
+            bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+        }
 
-            pBatch->m_points.clear();
-            pBatch->m_normals.clear();
-            pBatch->m_parameters.clear();
-            pBatch->m_colors.clear();
+        float result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    // Writes numComponents floats from pSrc to pDst in the given attribute type
+    void packAttrib(GLenum type, const float* pSrc, int numComponents, float* pDst)
+    {
+        uint32_t word = 0;
+        switch (type) {
+        case GL_INT_2_10_10_10_REV: {
+            // Normals are expected to be unit length. Normalizing keeps the direction of any which aren't, rather than clamping a component.
+            float len = sqrtf(pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1] + pSrc[2] * pSrc[2]);
+            float scale = len > 0 ? 511.0f / len : 0;
+            for (int j = 0; j < 3; j++) {
+                int32_t val = (int32_t)lroundf(pSrc[j] * scale);
+                word |= ((uint32_t)val & 0x3ff) << (10 * j);
+            }
+            break;
+        }
+        case GL_UNSIGNED_BYTE: {
+            uint8_t rgba[4] = { 0, 0, 0, 255 };
+            for (int j = 0; j < numComponents && j < 4; j++)
+                rgba[j] = (uint8_t)lroundf(min(max(pSrc[j], 0.0f), 1.0f) * 255);
+            memcpy(&word, rgba, sizeof(word));
+            break;
+        }
+        case GL_HALF_FLOAT: {
+            uint16_t halves[2] = { floatToHalf(pSrc[0]), floatToHalf(pSrc[1]) };
+            memcpy(&word, halves, sizeof(word));
+            break;
+        }
+        default:
+            memcpy(pDst, pSrc, numComponents * sizeof(float));
+            return;
+        }
+        memcpy(pDst, &word, sizeof(word));
+    }
+
+    // Inverse of packAttrib
+    void unpackAttrib(GLenum type, const float* pSrc, int numComponents, float* pDst)
+    {
+        uint32_t word;
+        memcpy(&word, pSrc, sizeof(word));
+        switch (type) {
+        case GL_INT_2_10_10_10_REV:
+            for (int j = 0; j < 3; j++) {
+                int32_t val = (int32_t)(word << (22 - 10 * j)) >> 22; // Sign extend the 10 bit field
+                pDst[j] = max(val / 511.0f, -1.0f);
+            }
+            break;
+        case GL_UNSIGNED_BYTE: {
+            uint8_t rgba[4];
+            memcpy(rgba, &word, sizeof(rgba));
+            for (int j = 0; j < numComponents && j < 4; j++)
+                pDst[j] = rgba[j] / 255.0f;
+            break;
+        }
+        case GL_HALF_FLOAT: {
+            uint16_t halves[2];
+            memcpy(halves, &word, sizeof(halves));
+            pDst[0] = halfToFloat(halves[0]);
+            pDst[1] = halfToFloat(halves[1]);
+            break;
+        }
+        default:
+            memcpy(pDst, pSrc, numComponents * sizeof(float));
+            break;
         }
     }
 }
 
+void MultiVboHandler::writeInterleaved(VertexBatch& batch, size_t vertBaseIndex, size_t numVerts, GLint offset, GLenum type, int numComponents, const vector<float>& src) const
+{
+    if (src.empty())
+        return;
+
+    assert(src.size() >= numVerts * numComponents);
+    writeInterleaved(batch, vertBaseIndex, numVerts, offset, type, numComponents, src.data(), numComponents);
+}
+
+// A srcStride of zero writes the same value to every vertex
+void MultiVboHandler::writeInterleaved(VertexBatch& batch, size_t vertBaseIndex, size_t numVerts, GLint offset, GLenum type, int numComponents, const float* pSrc, size_t srcStride) const
+{
+    if (offset == -1)
+        return;
+
+    const size_t stride = m_layout.floatsPerVertex();
+    float* pDst = batch.m_interleaved.data() + vertBaseIndex * stride + offset / sizeof(float);
+    if (type == GL_FLOAT) {
+        for (size_t vertIdx = 0; vertIdx < numVerts; vertIdx++) {
+            for (int j = 0; j < numComponents; j++)
+                pDst[j] = pSrc[j];
+            pDst += stride;
+            pSrc += srcStride;
+        }
+    } else {
+        for (size_t vertIdx = 0; vertIdx < numVerts; vertIdx++) {
+            packAttrib(type, pSrc, numComponents, pDst);
+            pDst += stride;
+            pSrc += srcStride;
+        }
+    }
+}
+
+bool MultiVboHandler::readInterleaved(const VertexBatch& batch, size_t vertIdx, GLint offset, GLenum type, int numComponents, float* pDst) const
+{
+    size_t srcIdx = vertIdx * m_layout.floatsPerVertex() + offset / sizeof(float);
+    if (offset == -1 || (srcIdx + VertexLayout::attribBytes(type, numComponents) / sizeof(float)) > batch.m_interleaved.size())
+        return false;
+
+    unpackAttrib(type, batch.m_interleaved.data() + srcIdx, numComponents, pDst);
+    return true;
+}
+
+void MultiVboHandler::markVertsDirty(VertexBatch& batch, size_t firstVert, size_t numVerts)
+{
+    if (numVerts == 0)
+        return;
+
+    // Undo/redo can write past the allocated blocks, keep appends beyond anything written
+    size_t lastVert = firstVert + numVerts;
+    if (batch.m_nextFreeVertIndex < lastVert)
+        batch.m_nextFreeVertIndex = lastVert;
+
+    auto& ranges = batch.m_dirtyVertRanges;
+    if (!ranges.empty() && ranges.back().second == firstVert)
+        ranges.back().second = lastVert; // Consecutive appends during a bulk tessellation
+    else
+        ranges.push_back(make_pair(firstVert, lastVert));
+}
+
+void MultiVboHandler::uploadBatch(VertexBatch& batch, bool smoothNormals)
+{
+    auto& ranges = batch.m_dirtyVertRanges;
+    size_t numVerts = batchCapacity(batch);
+    if (ranges.empty() || numVerts == 0) {
+        ranges.clear();
+        return;
+    }
+
+    // Colors can be written for part of a batch, pad them so every array covers every vertex
+    if (!m_layout.isInterleaved() && !batch.m_colors.empty() && batch.m_colors.size() < batch.m_points.size())
+        batch.m_colors.resize(batch.m_points.size());
+
+    sort(ranges.begin(), ranges.end());
+    size_t numMerged = 0;
+    for (size_t i = 1; i < ranges.size(); i++) {
+        auto& merged = ranges[numMerged];
+        if (ranges[i].first <= merged.second + OGL_DIRTY_RANGE_MERGE_GAP_VERTS)
+            merged.second = max(merged.second, ranges[i].second);
+        else
+            ranges[++numMerged] = ranges[i];
+    }
+    ranges.resize(numMerged + 1);
+
+    size_t numDirtyVerts = 0;
+    for (const auto& range : ranges)
+        numDirtyVerts += range.second - range.first;
+
+    // Sending most of the batch piecemeal costs more than replacing it. copyRangeToExistingVBO also refuses if the batch has grown or changed layout.
+    bool fullCopy = 2 * numDirtyVerts > numVerts;
+    for (size_t i = 0; !fullCopy && i < ranges.size(); i++) {
+        const auto& range = ranges[i];
+        size_t lastVert = min(range.second, numVerts);
+        if (range.first >= lastVert)
+            continue;
+
+        bool copied;
+        if (m_layout.isInterleaved())
+            copied = batch.m_VBO.copyInterleavedRangeToExistingVBO(range.first, lastVert - range.first, batch.m_interleaved, smoothNormals);
+        else
+            copied = batch.m_VBO.copyRangeToExistingVBO(range.first, lastVert - range.first, batch.m_points, batch.m_normals, smoothNormals, batch.m_parameters, batch.m_colors);
+        if (!copied) {
+            assert(i == 0); // The checks don't depend on the range, so only the first can fail
+            fullCopy = true;
+        }
+    }
+
+    if (fullCopy) {
+        bool copied;
+        if (m_layout.isInterleaved())
+            copied = batch.m_VBO.copyInterleavedToVBO(batch.m_interleaved, m_layout, smoothNormals);
+        else
+            copied = batch.m_VBO.copyToVBO(batch.m_points, batch.m_normals, smoothNormals, batch.m_parameters, batch.m_colors);
+        if (!copied)
+            batch.m_indirectDirty = true; // A failed copy releases all of the batch's buffers, including the indirect ones
+    }
+
+    ranges.clear();
+}
+
 bool MultiVboHandler::getVert(const Index& glIndicesOut, float coords[3]) const
 {
     if (m_batches.empty() || glIndicesOut.m_batchIndex >= m_batches.size())
         return false;
     shared_ptr<VertexBatch> pBatch = m_batches[glIndicesOut.m_batchIndex];
+    if (m_layout.isInterleaved())
+        return readInterleaved(*pBatch, glIndicesOut.m_vertIndex, m_layout.m_positionOffset, GL_FLOAT, 3, coords);
     if (pBatch->m_points.empty())
         return false;
     size_t vertIdx = 3 * glIndicesOut.m_vertIndex;
@@ -304,6 +597,8 @@ bool MultiVboHandler::getNormal(const Index& glIndicesOut, float coords[3]) cons
     if (m_batches.empty() || glIndicesOut.m_batchIndex >= m_batches.size())
         return false;
     shared_ptr<VertexBatch> pBatch = m_batches[glIndicesOut.m_batchIndex];
+    if (m_layout.isInterleaved())
+        return readInterleaved(*pBatch, glIndicesOut.m_vertIndex, m_layout.m_normalOffset, m_layout.m_normalType, 3, coords);
     size_t vertIdx = 3 * glIndicesOut.m_vertIndex;
     if (vertIdx + 2 < pBatch->m_normals.size()) {
         coords[0] = pBatch->m_normals[vertIdx + 0];
@@ -319,7 +614,7 @@ bool MultiVBO::getVBOArray(GLuint vboId, vector<float>& values) const
 {
     bool result = false;
     if (vboId != 0) {
-        glBindBuffer(GL_ARRAY_BUFFER, vboId);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, vboId);
         GLint size;
         glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
         if (size > 0) {
@@ -327,7 +622,7 @@ bool MultiVBO::getVBOArray(GLuint vboId, vector<float>& values) const
             glGetBufferSubData(GL_ARRAY_BUFFER, 0, size, (void*)values.data());
             result = true;
         }
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
     }
     return result;
 }
@@ -337,7 +632,7 @@ bool MultiVBO::getVBOArray(GLuint vboId, vector<unsigned int>& values) const
     bool result = false;
     if (vboId != 0) {
 
-        glBindBuffer(GL_ARRAY_BUFFER, vboId);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, vboId);
         GLint size;
         glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
         if (size > 0) {
@@ -345,7 +640,7 @@ bool MultiVBO::getVBOArray(GLuint vboId, vector<unsigned int>& values) const
             glGetBufferSubData(GL_ARRAY_BUFFER, 0, size, (void*)values.data());
             result = true;
         }
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        GLState::bindBuffer(GL_ARRAY_BUFFER, 0);
     }
     return result;
 }
@@ -368,6 +663,27 @@ bool MultiVboHandler::getRawData(size_t entityId, vector<float>& vertices, vecto
 
     const shared_ptr<VertexBatch> pBatch = m_batches[triIndices.m_batchIndex];
 
+    if (m_layout.isInterleaved()) {
+        // Split the card's copy back into separate arrays
+        vector<float> data;
+        if (m_layout.m_normalOffset == -1 || m_layout.m_texCoordOffset == -1 || !pBatch->m_VBO.getVBOArray(pBatch->m_VBO.vertexVboID(), data))
+            return false;
+
+        const size_t stride = m_layout.floatsPerVertex();
+        const size_t numVerts = data.size() / stride;
+        const size_t posIdx = m_layout.m_positionOffset / sizeof(float), normIdx = m_layout.m_normalOffset / sizeof(float), texIdx = m_layout.m_texCoordOffset / sizeof(float);
+        vertices.resize(3 * numVerts);
+        normals.resize(3 * numVerts);
+        parameters.resize(2 * numVerts);
+        for (size_t i = 0; i < numVerts; i++) {
+            const float* pVert = data.data() + i * stride;
+            unpackAttrib(GL_FLOAT, pVert + posIdx, 3, &vertices[3 * i]);
+            unpackAttrib(m_layout.m_normalType, pVert + normIdx, 3, &normals[3 * i]);
+            unpackAttrib(m_layout.m_texCoordType, pVert + texIdx, 2, &parameters[2 * i]);
+        }
+        return true;
+    }
+
     bool result = true;
     // Merge all the index ids in all maps to create the list for the entire
     result = result && pBatch->m_VBO.getVBOArray(pBatch->m_VBO.vertexVboID(), vertices);
@@ -390,6 +706,26 @@ bool MultiVboHandler::setColorVBO(size_t entityId, vector<float>& srcColors)
         return false;
     shared_ptr<VertexBatch> batchPtr = m_batches[triIndices.m_batchIndex];
 
+    if (m_layout.isInterleaved()) {
+        // Colors live in the vertex slots, write them there and send only this face's vertices. Other dirty ranges are left for
+        // endFaceTesselation, as is this one during tessellation.
+        if (m_layout.m_colorOffset == -1 || srcColors.size() < 3 * triIndices.m_numVertsInBatch)
+            return false;
+        writeInterleaved(*batchPtr, triIndices.m_vertBaseIndex, triIndices.m_numVertsInBatch, m_layout.m_colorOffset, m_layout.m_colorType, 3, srcColors);
+        if (m_insideBeginFaceTessellation) {
+            markVertsDirty(*batchPtr, triIndices.m_vertBaseIndex, triIndices.m_numVertsInBatch);
+            return true;
+        }
+
+        bool smoothNormals = batchPtr->m_VBO.usingSmoothNormals();
+        if (!batchPtr->m_VBO.copyInterleavedRangeToExistingVBO(triIndices.m_vertBaseIndex, triIndices.m_numVertsInBatch, batchPtr->m_interleaved, smoothNormals)) {
+            // The batch outgrew its buffer, it has to be replaced anyway
+            markVertsDirty(*batchPtr, triIndices.m_vertBaseIndex, triIndices.m_numVertsInBatch);
+            uploadBatch(*batchPtr, smoothNormals);
+        }
+        return true;
+    }
+
     auto& currentColors = batchPtr->m_colors;
 
     // Overwrite those that belong to this face with the new colors
@@ -427,7 +763,7 @@ bool MultiVboHandler::setBackColorVBO(size_t entityId, vector<float>& srcColors)
     // Overwrite those that belong to this face with the new colors
     size_t lastIdx = triIndices.m_vertBaseIndex + triIndices.m_numVertsInBatch;
     if (lastIdx >= currentColors.size()) {
-        currentColors.resize(batchPtr->m_points.size() / 3, 0);
+        currentColors.resize(batchCapacity(*batchPtr), 0);
     }
 
     // Write the new colors into the cache array
@@ -489,67 +825,51 @@ void MultiVboHandler::getStorageFor(size_t numVertsNeeded, bool needColorStorage
         }
         assert(batchIndex != _SIZE_T_ERROR && batchIndex < m_batches.size());
     } else {
-        shared_ptr<VertexBatch> batchPtr;
-        size_t vertBaseIndex = 0;
-        if (allocateSpaceForTriangles) {
-            static int MAX_FACE_VERTS_PER_BATCH = 0;
-            if (MAX_FACE_VERTS_PER_BATCH == 0) {
-                int val = OGL_FACE_BATCH_VERT_COUNT_MAX_K;
-                if (val < 2)
-                    val = 2;
-                MAX_FACE_VERTS_PER_BATCH = val * 1024;
-            }
-
-            for (size_t i = 0; i < m_batches.size(); i++) {
-                batchPtr = m_batches[i];
-                size_t numVertsInBatch = batchPtr->m_points.size() / 3;
-                if (numVertsInBatch + numVertsNeeded < MAX_FACE_VERTS_PER_BATCH) {
-                    batchIndex = i;
-                    vertBaseIndex = numVertsInBatch;
-                    break;
-                }
-            }
-        } else {
-            static int MAX_EDGE_VERTS_PER_BATCH = 0;
+        static size_t MAX_FACE_VERTS_PER_BATCH = max(OGL_FACE_BATCH_VERT_COUNT_MAX_K, 2) * 1024;
+        static size_t MAX_EDGE_VERTS_PER_BATCH = max(OGL_EDGE_BATCH_VERT_COUNT_MAX_K, 2) * 1024;
+        const size_t maxVertsPerBatch = allocateSpaceForTriangles ? MAX_FACE_VERTS_PER_BATCH : MAX_EDGE_VERTS_PER_BATCH;
 
-            if (MAX_EDGE_VERTS_PER_BATCH == 0) {
-                int val = OGL_EDGE_BATCH_VERT_COUNT_MAX_K;
-                if (val < 2)
-                    val = 2;
-                MAX_EDGE_VERTS_PER_BATCH = val * 1024;
-            }
-
-            for (size_t i = 0; i < m_batches.size(); i++) {
-                batchPtr = m_batches[i];
-                size_t numVertsInBatch = batchPtr->m_points.size() / 3;
-                if (numVertsInBatch + numVertsNeeded < MAX_EDGE_VERTS_PER_BATCH) {
-                    batchIndex = i;
-                    vertBaseIndex = numVertsInBatch;
-                    break;
-                }
+        shared_ptr<VertexBatch> batchPtr;
+        for (size_t i = 0; i < m_batches.size(); i++) {
+            batchPtr = m_batches[i];
+            size_t numVertsInBatch = batchPtr->m_nextFreeVertIndex;
+            if (numVertsInBatch + numVertsNeeded < maxVertsPerBatch) {
+                batchIndex = i;
+                break;
             }
         }
 
         if (!batchPtr || batchIndex == _SIZE_T_ERROR) {
             batchIndex = m_batches.size();
             batchPtr = make_shared<VertexBatch>(m_primitiveType);
+            batchPtr->m_VBO.setStreamBuffer(m_pStreamBuffer);
             m_batches.push_back(batchPtr);
         }
 
-        vertChunkIndex = calcVertChunkIndex(vertBaseIndex);
-
-        size_t sizeNeeded3 = 3 * (vertBaseIndex + blockSizeInChunks * vertChunkSize());
-        size_t sizeNeeded2 = 2 * (vertBaseIndex + blockSizeInChunks * vertChunkSize());
-
-        if (sizeNeeded3 >= batchPtr->m_points.size())
-            batchPtr->m_points.resize(sizeNeeded3);
-
-        if (allocateSpaceForTriangles) {
-            batchPtr->m_normals.resize(sizeNeeded3);
-            batchPtr->m_parameters.resize(sizeNeeded2);
-            if (needColorStorage) {
-                batchPtr->m_colors.resize(sizeNeeded3);
-                batchPtr->m_backColors.resize(sizeNeeded3);
+        // Round up, an undo/redo write can leave the end off a chunk boundary
+        vertChunkIndex = calcNumVertChunks(batchPtr->m_nextFreeVertIndex);
+        size_t vertsNeeded = (vertChunkIndex + blockSizeInChunks) * vertChunkSize();
+        batchPtr->m_nextFreeVertIndex = vertsNeeded;
+
+        size_t capacity = batchCapacity(*batchPtr);
+        if (vertsNeeded > capacity) {
+            // Grow by half again, so appending a face to a batch which is on the card usually fits in its VBO and only the face is sent
+            capacity = max(vertsNeeded, min(capacity + capacity / 2, maxVertsPerBatch));
+
+            if (m_layout.isInterleaved()) {
+                batchPtr->m_interleaved.resize(m_layout.floatsPerVertex() * capacity);
+                if (allocateSpaceForTriangles && (needColorStorage || !batchPtr->m_backColors.empty()))
+                    batchPtr->m_backColors.resize(3 * capacity);
+            } else {
+                batchPtr->m_points.resize(3 * capacity);
+                if (allocateSpaceForTriangles) {
+                    batchPtr->m_normals.resize(3 * capacity);
+                    batchPtr->m_parameters.resize(2 * capacity);
+                    if (needColorStorage || !batchPtr->m_colors.empty()) {
+                        batchPtr->m_colors.resize(3 * capacity);
+                        batchPtr->m_backColors.resize(3 * capacity);
+                    }
+                }
             }
         }
 
@@ -672,12 +992,22 @@ void MultiVboHandler::setEdgeStripTessellationInner(size_t batchIndex, size_t ve
 
     glIndicesOut.m_elementIndices.clear();
     auto batchPtr = m_batches[batchIndex];
+    markVertsDirty(*batchPtr, vertBaseIndex, numVerts);
 
     vector<unsigned int> indices;
 
+    if (m_layout.isInterleaved()) {
+        size_t sizeRequired = m_layout.floatsPerVertex() * (vertBaseIndex + numVerts);
+        if (batchPtr->m_interleaved.size() < sizeRequired)
+            batchPtr->m_interleaved.resize(sizeRequired);
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_positionOffset, GL_FLOAT, 3, lineStripPts);
+    }
+
     for (size_t vertIdx = 0; vertIdx < numVerts; vertIdx++) {
-        for (int j = 0; j < 3; j++) {
-            batchPtr->m_points[3 * (vertBaseIndex + vertIdx) + j] = lineStripPts[3 * vertIdx + j];
+        if (!m_layout.isInterleaved()) {
+            for (int j = 0; j < 3; j++) {
+                batchPtr->m_points[3 * (vertBaseIndex + vertIdx) + j] = lineStripPts[3 * vertIdx + j];
+            }
         }
 
         // Now that we've pushed the verts, next index is the current index
@@ -701,6 +1031,20 @@ void MultiVboHandler::setEdgeSegTessellationInner(size_t batchIndex, size_t vert
 
     glIndicesOut.m_elementIndices.clear();
     auto batchPtr = m_batches[batchIndex];
+    markVertsDirty(*batchPtr, vertBaseIndex, numVerts);
+
+    if (m_layout.isInterleaved()) {
+        size_t sizeRequired = m_layout.floatsPerVertex() * (vertBaseIndex + numVerts);
+        if (batchPtr->m_interleaved.size() < sizeRequired)
+            batchPtr->m_interleaved.resize(sizeRequired);
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_positionOffset, GL_FLOAT, 3, pts);
+        writeInterleaved(*batchPtr, vertBaseIndex, numVerts, m_layout.m_colorOffset, m_layout.m_colorType, 3, colors);
+
+        for (size_t i = 0; i < indicesIn.size(); i++) {
+            glIndicesOut.m_elementIndices.push_back(vertBaseIndex + indicesIn[i]);
+        }
+        return;
+    }
 
     // In the primary code path this array is always sized correctly, but during undo/redo there can be a mismatch. Resize it if it's too small.
     size_t spaceRequired = 3 * (vertBaseIndex + numVerts);
@@ -758,15 +1102,8 @@ void MultiVboHandler::endEdgeTesselation()
     m_insideBeginEdgeTessellation = false;
     for (size_t idx = 0; idx < m_batches.size(); idx++) {
         auto pBatch = m_batches[idx];
-        if (pBatch && pBatch->m_needsUpdate) {
-            pBatch->m_needsUpdate = false;
-            if (!pBatch->m_points.empty()) {
-                pBatch->m_VBO.copyToVBO(pBatch->m_points, pBatch->m_colors);
-
-                pBatch->m_points.clear();
-                pBatch->m_colors.clear();
-            }
-        }
+        if (pBatch)
+            uploadBatch(*pBatch, false);
     }
 }
 
@@ -811,6 +1148,7 @@ void MultiVboHandler::beginSettingElementIndices(size_t layerBitMask)
                     }
 
                     pBatch->m_VBO.releaseKeysElementVBO(key);
+                    pBatch->m_indirectDirty = true;
                 }
             }
             layer += 1;
@@ -850,6 +1188,7 @@ void MultiVboHandler::includeElementIndices(int key, const IndicesPtr& batchIndi
 void MultiVboHandler::endSettingElementIndices()
 {
     for (auto& pBatch : m_batches) {
+        pBatch->m_indirectDirty = true;
         for (const auto& pair : pBatch->m_indexMap) {
             pBatch->m_VBO.setIndexVBO(pair.first, pair.second);
         }
@@ -864,6 +1203,46 @@ void MultiVboHandler::draw(int key, MultiVBO::DrawVertexColorMode drawColors) co
     }
 }
 
+void MultiVboHandler::getKeysInDrawOrder(const VertexBatch& batch, vector<int>& keys) const
+{
+    keys.clear();
+    for (const auto& layerKeys : m_layersKeys) {
+        for (int key : layerKeys) {
+            if (m_keysToDraw.contains(key) && batch.m_indexMap.count(key) != 0)
+                keys.push_back(key);
+        }
+    }
+}
+
+void MultiVboHandler::drawAllKeysIndirect(MultiVBO::DrawVertexColorMode drawColors) const
+{
+    bool useIndirect = MultiVBO::isMultiDrawIndirectSupported();
+    vector<int> keys;
+    for (const auto& batchPtr : m_batches) {
+        if (useIndirect && !batchPtr->m_indirectDirty) {
+            batchPtr->m_VBO.drawIndirect(m_pShader, drawColors);
+            continue;
+        }
+
+        getKeysInDrawOrder(*batchPtr, keys);
+        if (useIndirect) {
+            vector<const vector<unsigned int>*> indexLists;
+            indexLists.reserve(keys.size());
+            for (int key : keys)
+                indexLists.push_back(&batchPtr->m_indexMap.find(key)->second);
+
+            batchPtr->m_VBO.setIndirectDraws(indexLists);
+            batchPtr->m_indirectDirty = false;
+            batchPtr->m_VBO.drawIndirect(m_pShader, drawColors);
+        } else {
+            bindCommonBuffers(batchPtr);
+            for (int key : keys)
+                drawKeyForBatch(key, batchPtr, drawColors);
+            unbindCommonBuffers(batchPtr);
+        }
+    }
+}
+
 void MultiVboHandler::bindCommonBuffers(const shared_ptr<VertexBatch>& batchPtr) const
 {
     auto& vbo = batchPtr->m_VBO;
@@ -1002,6 +1381,7 @@ size_t MultiVboHandler::VertexBatch::numBytes() const
     result += m_parameters.capacity() * sizeof(float);
     result += m_colors.capacity() * sizeof(float);
     result += m_backColors.capacity() * sizeof(float);
+    result += m_interleaved.capacity() * sizeof(float);
     result += m_allocatedChunks.capacity() * sizeof(size_t);
 
     for (const auto& pair : m_indexMap) {
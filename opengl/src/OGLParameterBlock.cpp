@@ -0,0 +1,282 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <OGLParameterBlock.h>
+
+using namespace std;
+using namespace OGL;
+
+namespace
+{
+    const size_t SLOTS_PER_REGION = 64;
+
+    GLenum glTypeOf(Arg::argtype type)
+    {
+        switch (type) {
+        case Arg::eInt: return GL_INT;
+        case Arg::eFloat: return GL_FLOAT;
+        case Arg::eFloat2: return GL_FLOAT_VEC2;
+        case Arg::eFloat3: return GL_FLOAT_VEC3;
+        case Arg::eFloat4: return GL_FLOAT_VEC4;
+        case Arg::eFloat16: return GL_FLOAT_MAT4;
+        }
+        return GL_NONE;
+    }
+}
+
+bool ParameterBlock::isSupported()
+{
+#ifdef WIN32
+    if (!hasVBOSupport() || !glGetUniformBlockIndex || !glUniformBlockBinding || !glBindBufferRange || !glGetActiveUniformsiv)
+        return false;
+#endif
+
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major > 3 || (major == 3 && minor >= 1))
+        return true;
+
+    GLint numExtensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+    for (GLint i = 0; i < numExtensions; i++) {
+        const char* pName = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (pName && strcmp(pName, "GL_ARB_uniform_buffer_object") == 0)
+            return true;
+    }
+
+    return false;
+}
+
+ParameterBlock::ParameterBlock(const string& blockName, GLuint bindingPoint)
+    : m_name(blockName)
+    , m_bindingPoint(bindingPoint)
+{
+}
+
+ParameterBlock::~ParameterBlock()
+{
+    if (m_bufferId)
+        GLState::deleteBuffers(1, &m_bufferId);
+}
+
+void ParameterBlock::setVariablei(const string& name, int value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value); }, value);
+}
+
+void ParameterBlock::setVariable(const string& name, float value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value); }, value);
+}
+
+void ParameterBlock::setVariable(const string& name, const col4f& value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value, 4); }, (const float*)value);
+}
+
+void ParameterBlock::setVariable(const string& name, const m44f& value)
+{
+    const float* pValue = value.transposef();
+    setArgValue(name, [&]() { return make_shared<Arg>(pValue, 16); }, pValue);
+}
+
+void ParameterBlock::setVariable(const string& name, const p4f& value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value, 4); }, (const float*)value);
+}
+
+void ParameterBlock::setVariable(const string& name, const p3f& value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value, 3); }, (const float*)value);
+}
+
+void ParameterBlock::setVariable(const string& name, const p2f& value)
+{
+    setArgValue(name, [&]() { return make_shared<Arg>(value, 2); }, (const float*)value);
+}
+
+template<class MAKE_ARG_FUNC, class T>
+void ParameterBlock::setArgValue(const string& name, MAKE_ARG_FUNC makeArg, T value)
+{
+    auto it = m_values.find(name);
+    if (it == m_values.end())
+        it = m_values.insert(make_pair(name, makeArg())).first;
+    else
+        it->second->set(value);
+
+    Arg& arg = *it->second;
+    if (!arg.dirty)
+        return;
+
+    arg.dirty = false;
+    if (hasLayout())
+        writeValue(name, arg);
+    m_dirty = true;
+}
+
+void ParameterBlock::commit()
+{
+    if (!m_dirty || !hasLayout())
+        return;
+
+    if (!m_pRing) {
+        GLint alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment > 0)
+            m_offsetAlignment = alignment;
+
+        size_t slotBytes = (m_data.size() + m_offsetAlignment - 1) / m_offsetAlignment * m_offsetAlignment;
+        m_pRing = make_unique<StreamBuffer>(slotBytes * SLOTS_PER_REGION);
+
+        if (!m_pRing->isPersistent())
+            createBuffer();
+    }
+
+    size_t offset;
+    void* pSlot = m_pRing->alloc(m_data.size(), offset, m_offsetAlignment);
+    if (!pSlot) {
+        // Alignment padding can leave no room in a region, write the block in place. A frame still reading it may see the new values.
+        if (!m_bufferId)
+            createBuffer();
+        GLState::bindBuffer(GL_UNIFORM_BUFFER, m_bufferId);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, m_data.size(), m_data.data());
+        GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+        GLState::bindBufferRange(GL_UNIFORM_BUFFER, m_bindingPoint, m_bufferId, 0, m_data.size());
+        m_dirty = false;
+        return;
+    }
+
+    memcpy(pSlot, m_data.data(), m_data.size());
+
+    if (m_pRing->isPersistent()) {
+        GLState::bindBufferRange(GL_UNIFORM_BUFFER, m_bindingPoint, m_pRing->bufferId(), offset, m_data.size());
+    } else {
+        m_pRing->copyTo(m_bufferId, 0, offset, m_data.size());
+        GLState::bindBufferRange(GL_UNIFORM_BUFFER, m_bindingPoint, m_bufferId, 0, m_data.size());
+    }
+
+    m_dirty = false;
+}
+
+void ParameterBlock::createBuffer()
+{
+    glGenBuffers(1, &m_bufferId);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, m_bufferId);
+    glBufferData(GL_UNIFORM_BUFFER, m_data.size(), nullptr, GL_DYNAMIC_DRAW);
+    GLState::bindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void ParameterBlock::setLayout(GLuint programId, GLuint blockIndex)
+{
+    GLint dataSize = 0;
+    glGetActiveUniformBlockiv(programId, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+    if (hasLayout()) {
+        assert(dataSize == (GLint)m_data.size() && "parameter block is declared differently in two programs");
+        return;
+    }
+
+    GLint numMembers = 0, maxNameLength = 0;
+    glGetActiveUniformBlockiv(programId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &numMembers);
+    glGetProgramiv(programId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    if (dataSize <= 0 || numMembers <= 0)
+        return;
+
+    vector<GLint> memberIndices(numMembers);
+    glGetActiveUniformBlockiv(programId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, memberIndices.data());
+
+    vector<GLuint> indices(memberIndices.begin(), memberIndices.end());
+    vector<GLint> offsets(numMembers), arraySizes(numMembers), arrayStrides(numMembers), matrixStrides(numMembers);
+    vector<GLint> types(numMembers), rowMajors(numMembers);
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_OFFSET, offsets.data());
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_SIZE, arraySizes.data());
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_ARRAY_STRIDE, arrayStrides.data());
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data());
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_TYPE, types.data());
+    glGetActiveUniformsiv(programId, numMembers, indices.data(), GL_UNIFORM_IS_ROW_MAJOR, rowMajors.data());
+
+    vector<char> nameBuf(maxNameLength + 1);
+    for (GLint i = 0; i < numMembers; i++) {
+        GLsizei length = 0;
+        glGetActiveUniformName(programId, indices[i], (GLsizei)nameBuf.size(), &length, nameBuf.data());
+
+        // Arrays are reported as their first element and members of a named instance with the block name
+        string name(nameBuf.data(), length);
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            name.resize(name.size() - 3);
+        if (name.compare(0, m_name.size() + 1, m_name + ".") == 0)
+            name.erase(0, m_name.size() + 1);
+
+        Member& member = m_layout[name];
+        member.m_offset = offsets[i];
+        member.m_arraySize = arraySizes[i];
+        member.m_arrayStride = arrayStrides[i];
+        member.m_matrixStride = matrixStrides[i];
+        member.m_type = types[i];
+        member.m_rowMajor = rowMajors[i] != 0;
+    }
+
+    m_data.resize(dataSize, 0);
+    for (auto& value : m_values)
+        writeValue(value.first, *value.second);
+    m_dirty = true;
+}
+
+void ParameterBlock::writeValue(const string& name, Arg& arg)
+{
+    string memberName = name;
+    GLint element = 0;
+    size_t bracket = name.find('[');
+    if (bracket != string::npos && name.back() == ']') {
+        memberName = name.substr(0, bracket);
+        element = atoi(name.c_str() + bracket + 1);
+    }
+
+    auto it = m_layout.find(memberName);
+    if (it == m_layout.end() || element < 0 || element >= it->second.m_arraySize) {
+        assert(!"not a member of the parameter block");
+        return;
+    }
+
+    const Member& member = it->second;
+    GLenum type = glTypeOf(arg.getType());
+    if (type != member.m_type && !(type == GL_INT && member.m_type == GL_BOOL)) {
+        assert(!"parameter block type error");
+        return;
+    }
+
+    char* pDst = m_data.data() + member.m_offset + element * member.m_arrayStride;
+    switch (arg.getType()) {
+    case Arg::eInt: {
+        GLint value = arg.getInt();
+        memcpy(pDst, &value, sizeof(value));
+        break;
+    }
+    case Arg::eFloat: {
+        float value = arg.getFloat();
+        memcpy(pDst, &value, sizeof(value));
+        break;
+    }
+    case Arg::eFloat2:
+        memcpy(pDst, arg.getFloatPtr(), 2 * sizeof(float));
+        break;
+    case Arg::eFloat3:
+        memcpy(pDst, arg.getFloatPtr(), 3 * sizeof(float));
+        break;
+    case Arg::eFloat4:
+        memcpy(pDst, arg.getFloatPtr(), 4 * sizeof(float));
+        break;
+    case Arg::eFloat16: {
+        // Stored column major, as glUniformMatrix4fv takes it, each column or row of the block starts matrixStride apart
+        const float* pSrc = arg.getFloatPtr();
+        for (int col = 0; col < 4; col++) {
+            for (int row = 0; row < 4; row++) {
+                size_t pos = member.m_rowMajor ? row * member.m_matrixStride + col * sizeof(float) : col * member.m_matrixStride + row * sizeof(float);
+                memcpy(pDst + pos, pSrc + 4 * col + row, sizeof(float));
+            }
+        }
+        break;
+    }
+    }
+}
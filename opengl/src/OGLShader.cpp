@@ -22,7 +22,9 @@
 #include <fstream>
 #include <filesystem>
 #include <iostream>
+#include <OGLExtensions.h>
 #include <OGLShader.h>
+#include <OGLParameterBlock.h>
 
 using namespace std;
 using namespace OGL;
@@ -61,6 +63,89 @@ void ShaderBase::dumpGlErrors(const char* filename, int lineNumber)
     }
 }
 
+namespace
+{
+    enum DebugOutputState {
+        DEBUG_OUTPUT_UNKNOWN,
+        DEBUG_OUTPUT_CALLBACK,
+        DEBUG_OUTPUT_GET_ERROR,
+    };
+
+    DebugOutputState s_debugOutput = DEBUG_OUTPUT_UNKNOWN;
+    const char* s_pLastCheckFile = "";
+    int s_lastCheckLine = 0;
+    size_t s_sampleInterval = 1024;
+    size_t s_sampleCount = 0;
+
+    void APIENTRY debugMessageCallback(GLenum /*source*/, GLenum type, GLuint /*id*/, GLenum /*severity*/, GLsizei /*length*/, const GLchar* pMessage, const void* /*pUserParam*/)
+    {
+        // Drivers also send performance and portability notes, only errors are reported
+        if (type != GL_DEBUG_TYPE_ERROR)
+            return;
+
+        cout << "glErr (after " << s_pLastCheckFile << ":" << s_lastCheckLine << "): " << pMessage << "\n";
+        assert(!"glError");
+    }
+}
+
+bool ShaderBase::installDebugCallback()
+{
+    s_debugOutput = DEBUG_OUTPUT_GET_ERROR;
+
+#ifdef WIN32
+    if (!glDebugMessageCallback)
+        return false;
+#endif
+
+    // Outside a debug context the driver isn't required to report anything
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    if ((flags & GL_CONTEXT_FLAG_DEBUG_BIT) == 0)
+        return false;
+
+    glGetError(); // Clear anything from before the callback
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(debugMessageCallback, nullptr);
+    if (glGetError() != GL_NO_ERROR)
+        return false;
+
+    s_debugOutput = DEBUG_OUTPUT_CALLBACK;
+    return true;
+}
+
+void ShaderBase::checkGlErrors(const char* filename, int lineNumber)
+{
+    if (s_debugOutput == DEBUG_OUTPUT_UNKNOWN)
+        installDebugCallback();
+
+    if (s_debugOutput == DEBUG_OUTPUT_CALLBACK) {
+        s_pLastCheckFile = filename;
+        s_lastCheckLine = lineNumber;
+    } else
+        dumpGlErrors(filename, lineNumber);
+}
+
+void ShaderBase::sampleGlErrors(const char* filename, int lineNumber)
+{
+    // Reports the error at the sampled location, it happened there or in a call since the previous sample
+    if (s_sampleInterval && ++s_sampleCount >= s_sampleInterval) {
+        s_sampleCount = 0;
+        dumpGlErrors(filename, lineNumber);
+    }
+}
+
+void ShaderBase::setGlErrorSampleInterval(size_t interval)
+{
+    s_sampleInterval = interval;
+    s_sampleCount = 0;
+}
+
+size_t ShaderBase::getGlErrorSampleInterval()
+{
+    return s_sampleInterval;
+}
+
 #define HDTIMELOG(X)
 //#define CHECK_GLSL_STATE
 #define GL_IGNORE_ERROR
@@ -128,7 +213,11 @@ void  Arg::set(int val)
         assert(!"type error");
         return;
     }
-    ival = val;
+    if( ival != val )
+    {
+        ival = val;
+        dirty = true;
+    }
 }
 
 void  Arg::set(float val)
@@ -138,19 +227,30 @@ void  Arg::set(float val)
         assert(!"type error");
         return;
     }
-    fval = val;
+    if( fval != val )
+    {
+        fval = val;
+        dirty = true;
+    }
 }
 
 void  Arg::set(const float* val)
 {
+    int numFloats = 0;
     switch(type)
     {
-    case eFloat :  fval = *val;                            break;
-    case eFloat2:  memcpy( fvalArr, val, sizeof(float)*2) ; break;
-    case eFloat3:  memcpy( fvalArr, val, sizeof(float)*3) ; break;
-    case eFloat4:  memcpy( fvalArr, val, sizeof(float)*4) ; break;
-    case eFloat16: memcpy( fvalArr, val, sizeof(float)*16); break;
-    default: assert(0);
+    case eFloat :  numFloats = 1;  break;
+    case eFloat2:  numFloats = 2;  break;
+    case eFloat3:  numFloats = 3;  break;
+    case eFloat4:  numFloats = 4;  break;
+    case eFloat16: numFloats = 16; break;
+    default: assert(0); return;
+    }
+
+    if( memcmp( fvalArr, val, sizeof(float)*numFloats ) != 0 )
+    {
+        memcpy( fvalArr, val, sizeof(float)*numFloats );
+        dirty = true;
     }
 }
 
@@ -201,7 +301,7 @@ float Arg::getFloatAt(int idx)
 
 void Arg::allocFloat(const float* val, int numFloats)
 {
-    assert(numFloats <= 4);
+    assert(numFloats <= 16);
     memcpy( fvalArr, val, sizeof(float)*numFloats);
 }
 
@@ -253,166 +353,195 @@ void ShaderBase::enable(bool set)
     mEnabled = set;
 }
 
-void ShaderBase::setVariablei( const string& name, int  value )
+template<class MAKE_ARG_FUNC>
+ShaderBase::UniformHandle ShaderBase::findOrAddUniform(const string& name, MAKE_ARG_FUNC makeArg)
 {
     if( !m_defaultsLoaded ) 
         loadDefaultVariables();
 
     auto it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert(make_pair(name, make_shared<Arg>(value)));
-    else
-        it->second->set(value);
+    if( it != m_argumentMap.end() )
+        return it->second->handle;
 
-    if(m_bound)
+    shared_ptr<Arg> pArg = makeArg();
+    pArg->handle = (UniformHandle)m_uniformTable.size();
+    if( _programId )
     {
-		int progId = programID();
-		int dbg = glGetUniformLocationARB(progId, "DepthPeel");
-        int argLocation = glGetUniformLocationARB( progId, name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform1i( argLocation, value ); GL_ASSERT;
-        }
+        // Variables added before load() are resolved when the program is linked
+        pArg->location = glGetUniformLocation( _programId, name.c_str()); GL_ASSERT;
     }
+
+    m_argumentMap.insert( make_pair( name, pArg ) );
+    m_uniformTable.push_back( pArg );
+    return pArg->handle;
 }
 
-void ShaderBase::setVariable( const string& name, float  value )
+template<class T>
+void ShaderBase::setArgValue(UniformHandle handle, T value)
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
-
-    ArgMapType::iterator it;
-
-    it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value ) ) );
-    else
-        it->second->set(value);
-
-    if(m_bound)
+    if( handle < 0 || handle >= (UniformHandle)m_uniformTable.size() )
     {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform1f( argLocation, value ); GL_ASSERT;
-        }
+        assert(!"invalid uniform handle");
+        return;
     }
+
+    Arg& arg = *m_uniformTable[handle];
+    arg.set( value );
+    if( m_bound )
+        uploadUniform( arg );
 }
 
-void ShaderBase::setVariable( const string& name, const col4f& value )
+void ShaderBase::uploadUniform(Arg& arg) const
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
+    if( !arg.dirty )
+        return;
+    arg.dirty = false;
 
-    ArgMapType::iterator it;
+    if( arg.location < 0 )
+        return;
 
-    it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value, 4 ) ) );
-    else
-        it->second->set(value);
+    switch( arg.getType() )
+    {
+    case Arg::eInt: 
+        glUniform1i( arg.location, arg.getInt() ); GL_ASSERT;
+        break;
+    case Arg::eFloat:
+        glUniform1f( arg.location, arg.getFloat() );  GL_ASSERT;
+        break;
+    case Arg::eFloat2: 
+        glUniform2fv( arg.location, 1, arg.getFloatPtr()); GL_ASSERT;
+        break;
+    case Arg::eFloat3:
+        glUniform3fv( arg.location, 1, arg.getFloatPtr()); GL_ASSERT;
+        break;
+    case Arg::eFloat4:
+        glUniform4fv( arg.location, 1, arg.getFloatPtr()); GL_ASSERT;
+        break;
+    case Arg::eFloat16:
+        glUniformMatrix4fv( arg.location, 1, false, arg.getFloatPtr());    GL_ASSERT;
+        break;
+    default: assert(0);
+    }
+}
 
-    if(m_bound)
+void ShaderBase::addParameterBlock( const shared_ptr<ParameterBlock>& pBlock )
+{
+    for( auto& pExisting : m_parameterBlocks )
     {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform4fv(argLocation, 1, value); GL_ASSERT;
-        }
+        if( pExisting == pBlock )
+            return;
     }
+
+    m_parameterBlocks.push_back( pBlock );
+    if( _programId )
+        attachParameterBlock( *pBlock );
 }
 
-void ShaderBase::setVariable( const string& name, const m44f&  value )
+void ShaderBase::attachParameterBlock( ParameterBlock& block )
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
+    if( !ParameterBlock::isSupported() )
+        return;
 
-    ArgMapType::iterator it;
+    // Programs which don't declare the block ignore it
+    GLuint blockIndex = glGetUniformBlockIndex( _programId, block.getName().c_str()); GL_ASSERT;
+    if( blockIndex == GL_INVALID_INDEX )
+        return;
 
-    it = m_argumentMap.find( name );
+    glUniformBlockBinding( _programId, blockIndex, block.getBindingPoint()); GL_ASSERT;
+    block.setLayout( _programId, blockIndex ); GL_ASSERT;
+}
+
+ShaderBase::UniformHandle ShaderBase::findUniform( const string& name ) const
+{
+    auto it = m_argumentMap.find( name );
     if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value.transposef(), 16 ) ) );
-    else
-        it->second->set( value.transposef() );
+        return INVALID_UNIFORM;
+    return it->second->handle;
+}
 
-    if(m_bound)
-    {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniformMatrix4fv( argLocation, 1, false, value.transposef() );  GL_ASSERT;
-        }
-    }
+ShaderBase::UniformHandle ShaderBase::setVariablei( const string& name, int  value )
+{
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value ); } );
+    setVariablei( handle, value );
+    return handle;
+}
 
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, float  value )
+{
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value ); } );
+    setVariable( handle, value );
+    return handle;
 }
 
-void ShaderBase::setVariable( const string& name, const p4f&   value )
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, const col4f& value )
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value, 4 ); } );
+    setVariable( handle, value );
+    return handle;
+}
 
-    ArgMapType::iterator it;
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, const m44f&  value )
+{
+    const float* pValue = value.transposef();
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( pValue, 16 ); } );
+    setArgValue( handle, pValue );
+    return handle;
+}
 
-    it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value, 4 ) ) );
-    else
-        it->second->set(value);
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, const p4f&   value )
+{
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value, 4 ); } );
+    setVariable( handle, value );
+    return handle;
+}
 
-    if(m_bound)
-    {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform4fv(argLocation, 1, value); GL_ASSERT;
-        }
-    }
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, const p3f&   value )
+{
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value, 3 ); } );
+    setVariable( handle, value );
+    return handle;
 }
 
-void ShaderBase::setVariable( const string& name, const p3f&   value )
+ShaderBase::UniformHandle ShaderBase::setVariable( const string& name, const p2f& value )
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
+    UniformHandle handle = findOrAddUniform( name, [&]() { return make_shared<Arg>( value, 2 ); } );
+    setVariable( handle, value );
+    return handle;
+}
 
-    ArgMapType::iterator it;
+void ShaderBase::setVariablei( UniformHandle handle, int  value )
+{
+    setArgValue( handle, value );
+}
 
-    it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value, 3 ) ) );
-    else
-        it->second->set(value);
+void ShaderBase::setVariable( UniformHandle handle, float  value )
+{
+    setArgValue( handle, value );
+}
 
-    if(m_bound)
-    {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform3fv(argLocation, 1, (const float*)value); GL_ASSERT;
-        }
-    }
+void ShaderBase::setVariable( UniformHandle handle, const col4f& value )
+{
+    setArgValue( handle, (const float*)value );
 }
 
-void ShaderBase::setVariable( const string& name, const p2f& value )
+void ShaderBase::setVariable( UniformHandle handle, const m44f&  value )
 {
-    if( !m_defaultsLoaded ) 
-        loadDefaultVariables();
+    setArgValue( handle, (const float*)value.transposef() );
+}
 
-    ArgMapType::iterator it;
+void ShaderBase::setVariable( UniformHandle handle, const p4f&   value )
+{
+    setArgValue( handle, (const float*)value );
+}
 
-    it = m_argumentMap.find( name );
-    if( it == m_argumentMap.end() )
-        m_argumentMap.insert( ArgMapType::value_type( name, new Arg( value, 2 ) ) );
-    else
-        it->second->set(value);
+void ShaderBase::setVariable( UniformHandle handle, const p3f&   value )
+{
+    setArgValue( handle, (const float*)value );
+}
 
-    if(m_bound)
-    {
-        int argLocation = glGetUniformLocationARB( programID(), name.c_str()); GL_ASSERT;
-        if( argLocation >= 0 )
-        {
-            glUniform2fv(argLocation, 1, value); GL_ASSERT;
-        }
-    }
+void ShaderBase::setVariable( UniformHandle handle, const p2f& value )
+{
+    setArgValue( handle, (const float*)value );
 }
 
 #if HAS_SHADER_SUBROUTINES
@@ -987,6 +1116,16 @@ bool ShaderBase::load()
     // Link The Program Object
     glLinkProgram(_programId); GL_ASSERT
 
+    // Resolve the locations of the variables set so far, they're all sent on the first bind
+    for( auto& arg : m_argumentMap )
+    {
+        arg.second->location = glGetUniformLocation( _programId, arg.first.c_str()); GL_ASSERT;
+        arg.second->dirty = true;
+    }
+
+    for( auto& pBlock : m_parameterBlocks )
+        attachParameterBlock( *pBlock );
+
     bind();
     // These are required. If they fail, abort
     m_vertLoc = glGetAttribLocation(_programId, _vertAttribName.c_str()); GL_ASSERT;
@@ -1034,12 +1173,12 @@ bool ShaderBase::bind()
     int progID = programID();
     if( progID && !m_error )
     {
-        glUseProgramObjectARB( progID ); GL_ASSERT; // Use The Program Object Instead Of Fixed Function OpenGL
+        Extensions::GLState::useProgram(progID); GL_ASSERT; // Use The Program Object Instead Of Fixed Function OpenGL
         hasProgramError( progID );       // this can show additional errors...
     }
 
     else if (m_error) {             // some error state, so stop trying to load or bind
-        glUseProgramObjectARB(0); GL_ASSERT; // Fixed Function OpenGL
+        Extensions::GLState::useProgram(0); GL_ASSERT; // Fixed Function OpenGL
 
     } else // must be first time, shader needs loading
     {
@@ -1048,7 +1187,8 @@ bool ShaderBase::bind()
    
         else
         {
-            glUseProgramObjectARB( progID ); GL_ASSERT; // Use The Program Object Instead Of Fixed Function OpenGL
+            progID = programID(); // was zero before load() created the program
+            Extensions::GLState::useProgram(progID); GL_ASSERT; // Use The Program Object Instead Of Fixed Function OpenGL
 
             if( hasProgramError( progID ) )
             {
@@ -1101,74 +1241,25 @@ bool ShaderBase::bind()
 				}
 			}
 
-            int samplerLocation = glGetUniformLocationARB( progID, Uni2Ansi(textureName));  GL_ASSERT;
+            int samplerLocation = glGetUniformLocation( progID, Uni2Ansi(textureName));  GL_ASSERT;
             
             HLOG(Format("Bound texture %s unit: %d loc: %d hwid: %d",(const string&)textureName, texUnit, samplerLocation, hwid ));
 
             if( samplerLocation >= 0 )
             {
-                glUniform1iARB(samplerLocation, texUnit);    GL_ASSERT;
+                glUniform1i(samplerLocation, texUnit);    GL_ASSERT;
             }
         }
     }
 #endif
 
-    //send all the arguments
-    if(m_argumentMap.size())
-    {
-        for( ArgMapType::iterator arg = m_argumentMap.begin(); arg != m_argumentMap.end(); arg++ )
-        {
-            string argName =  arg->first;
-            Arg& argVal  = *arg->second;
-
-            int argLocation = glGetUniformLocationARB( programID(), argName.c_str()); GL_ASSERT;
+    // Uniform values stay with the program, only send the ones changed since the last upload
+    for( auto& pArg : m_uniformTable )
+        uploadUniform( *pArg );
 
-            if( argLocation >= 0 )
-            {
-                /* This would be good to be able to switch on per shader
-                string argval;
-                switch(argVal.getType() )
-                {
-                case Arg::eFloat: argval = Format(" %.1f",argVal.getFloat());break;
-                case Arg::eFloat3:
-                    {
-                        float* val=argVal.getFloatPtr();
-                        argval = Format(" %.1f %.1f %.1f",val[0],val[1],val[2]);break;
-                    }
-                case Arg::eFloat4:
-                    {
-                        float* val=argVal.getFloatPtr();
-                        argval = Format(" %.1f %.1f %.1f %.1f",val[0],val[1],val[2],val[3]);break;
-                    }
-                }
-                HLOG(Format("Binding argName:%s val:%s",(const string&)argName,(const string&)argval));
-                */
-
-                switch( argVal.getType() )
-                {
-                case Arg::eInt: 
-                    glUniform1i( argLocation, argVal.getInt() ); GL_ASSERT;
-                    break;
-                case Arg::eFloat:
-                    glUniform1f( argLocation, argVal.getFloat() );  GL_ASSERT;
-                    break;
-                case Arg::eFloat2: 
-                    glUniform2fv(argLocation, 1, argVal.getFloatPtr()); GL_ASSERT;
-                    break;
-                case Arg::eFloat3:
-                    glUniform3fv(argLocation, 1, argVal.getFloatPtr()); GL_ASSERT;
-                    break;
-                case Arg::eFloat4:
-                    glUniform4fv(argLocation, 1, argVal.getFloatPtr()); GL_ASSERT;
-                    break;
-                case Arg::eFloat16:
-                    glUniformMatrix4fv( argLocation, 1, false, argVal.getFloatPtr());    GL_ASSERT;
-                    break;
-                default: assert(0);
-                }
-            }
-        }
-    }
+    // Shared blocks are written once for all the programs using them, when the first one is bound after a change
+    for( auto& pBlock : m_parameterBlocks )
+        pBlock->commit();
 
     m_bound = true;
     return m_error;
@@ -1348,7 +1439,7 @@ bool ShaderBase::unBind()
     CHECK_GLSL_STATE;
     assert(m_bound); // logic error can't unbind an unbound shader
 
-    glUseProgramObjectARB(0);   GL_ASSERT; // Back to Fixed Function OpenGL
+    Extensions::GLState::useProgram(0);   GL_ASSERT; // Back to Fixed Function OpenGL
 
 #if TEXTURE_SUPPORT
 	//reset all the states of all the texture units
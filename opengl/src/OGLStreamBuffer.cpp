@@ -0,0 +1,156 @@
+#include <assert.h>
+#include <string.h>
+
+#include <OGLStreamBuffer.h>
+
+using namespace std;
+using namespace OGL;
+
+namespace
+{
+    const size_t STREAM_ALIGNMENT = 16;
+}
+
+bool StreamBuffer::isPersistentSupported()
+{
+#ifdef WIN32
+    if (!hasVBOSupport() || !glBufferStorage || !glFenceSync || !glClientWaitSync || !glCopyBufferSubData || !glMapBufferRange)
+        return false;
+#endif
+
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major > 4 || (major == 4 && minor >= 4))
+        return true;
+
+    GLint numExtensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+    for (GLint i = 0; i < numExtensions; i++) {
+        const char* pName = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (pName && strcmp(pName, "GL_ARB_buffer_storage") == 0)
+            return true;
+    }
+
+    return false;
+}
+
+StreamBuffer::StreamBuffer(size_t regionBytes, size_t numRegions)
+    : m_regionBytes((regionBytes + STREAM_ALIGNMENT - 1) & ~(STREAM_ALIGNMENT - 1))
+    , m_numRegions(numRegions < 1 ? 1 : numRegions)
+{
+    size_t totalBytes = m_regionBytes * m_numRegions;
+    m_fences.resize(m_numRegions, nullptr);
+
+    if (isPersistentSupported()) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glGenBuffers(1, &m_bufferId);
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, m_bufferId);
+        glBufferStorage(GL_COPY_READ_BUFFER, totalBytes, nullptr, flags);
+        m_pMapped = (char*)glMapBufferRange(GL_COPY_READ_BUFFER, 0, totalBytes, flags);
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        if (!m_pMapped) {
+            assert(!"persistent mapping failed");
+            GLState::deleteBuffers(1, &m_bufferId);
+            m_bufferId = 0;
+        }
+    }
+
+    if (!m_pMapped)
+        m_staging.resize(totalBytes);
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    for (auto& fence : m_fences) {
+        if (fence)
+            glDeleteSync(fence);
+    }
+
+    if (m_bufferId) {
+        // The mapping has to be released before the buffer, the GPU may still be reading it
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, m_bufferId);
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, 0);
+        GLState::deleteBuffers(1, &m_bufferId);
+    }
+}
+
+void* StreamBuffer::alloc(size_t numBytes, size_t& offset, size_t alignment)
+{
+    if (numBytes > m_regionBytes)
+        return nullptr;
+
+    // Aligned within the whole buffer, regions only start on 16 byte boundaries
+    alignment = alignment < STREAM_ALIGNMENT ? STREAM_ALIGNMENT : alignment;
+    size_t regionStart = m_region * m_regionBytes;
+    size_t start = ((regionStart + m_regionUsed + alignment - 1) & ~(alignment - 1)) - regionStart;
+    if (start + numBytes > m_regionBytes) {
+        nextRegion();
+        regionStart = m_region * m_regionBytes;
+        start = ((regionStart + alignment - 1) & ~(alignment - 1)) - regionStart;
+        if (start + numBytes > m_regionBytes)
+            return nullptr;
+    }
+
+    m_regionUsed = start + numBytes;
+    offset = regionStart + start;
+
+    return m_pMapped ? m_pMapped + offset : m_staging.data() + offset;
+}
+
+void StreamBuffer::copyTo(GLuint dstBufferId, size_t dstOffset, size_t offset, size_t numBytes)
+{
+    if (numBytes == 0)
+        return;
+
+    if (m_pMapped) {
+        // Coherent mapping, the writes are visible to commands issued after them without a flush
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, m_bufferId);
+        GLState::bindBuffer(GL_COPY_WRITE_BUFFER, dstBufferId);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, dstOffset, numBytes);
+        GLState::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        GLState::bindBuffer(GL_COPY_READ_BUFFER, 0);
+    } else {
+        GLState::bindBuffer(GL_COPY_WRITE_BUFFER, dstBufferId);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, dstOffset, numBytes, m_staging.data() + offset);
+        GLState::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+}
+
+void StreamBuffer::nextRegion()
+{
+    if (m_pMapped) {
+        assert(!m_fences[m_region]);
+        m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    m_region = (m_region + 1) % m_numRegions;
+    m_regionUsed = 0;
+    waitForRegion(m_region);
+}
+
+void StreamBuffer::waitForRegion(size_t region)
+{
+    GLsync& fence = m_fences[region];
+    if (!fence)
+        return;
+
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        m_numStalls++;
+
+        // Flush on the first wait, in case the fence is still in our command queue
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        do {
+            status = glClientWaitSync(fence, flags, 1000000);
+            flags = 0;
+        } while (status == GL_TIMEOUT_EXPIRED);
+    }
+    assert(status != GL_WAIT_FAILED);
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
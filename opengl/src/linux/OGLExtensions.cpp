@@ -1,6 +1,8 @@
 #include <OGLExtensions.h>
 #include <assert.h>
 
+using namespace OGL;
+
 #define	RETURN_IF_NOT_FIRST_TIME(a) static bool first=true; if(!first) return a; first = false;
 
 #ifdef WIN32
@@ -12,768 +14,768 @@
 #define GET_EXT_POINTER_MESSAGE_RETURN_FALSE(name, type) { static bool ok=true; static bool first=true; if(first){ first=false; name = (type)wglGetProcAddress(#name); if(!name){ ok=false; return false; }} if(!ok) return false;}
 
 
-PFNGLACTIVESHADERPROGRAMPROC    COglExtensions::glActiveShaderProgram = 0;
-PFNGLACTIVETEXTUREPROC    COglExtensions::glActiveTexture = 0;
-PFNGLATTACHOBJECTARBPROC    COglExtensions::glAttachObjectARB = 0;
-PFNGLATTACHSHADERPROC    COglExtensions::glAttachShader = 0;
-PFNGLBEGINCONDITIONALRENDERPROC    COglExtensions::glBeginConditionalRender = 0;
-PFNGLBEGINQUERYPROC    COglExtensions::glBeginQuery = 0;
-PFNGLBEGINQUERYINDEXEDPROC    COglExtensions::glBeginQueryIndexed = 0;
-PFNGLBEGINTRANSFORMFEEDBACKPROC    COglExtensions::glBeginTransformFeedback = 0;
-PFNGLBINDATTRIBLOCATIONPROC    COglExtensions::glBindAttribLocation = 0;
-PFNGLBINDBUFFERPROC    COglExtensions::glBindBuffer = 0;
-PFNGLBINDBUFFERBASEPROC    COglExtensions::glBindBufferBase = 0;
-PFNGLBINDBUFFERRANGEPROC    COglExtensions::glBindBufferRange = 0;
-PFNGLBINDBUFFERSBASEPROC    COglExtensions::glBindBuffersBase = 0;
-PFNGLBINDBUFFERSRANGEPROC    COglExtensions::glBindBuffersRange = 0;
-PFNGLBINDFRAGDATALOCATIONPROC    COglExtensions::glBindFragDataLocation = 0;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC    COglExtensions::glBindFragDataLocationIndexed = 0;
-PFNGLBINDFRAMEBUFFERPROC    COglExtensions::glBindFramebuffer = 0;
-PFNGLBINDIMAGETEXTUREPROC    COglExtensions::glBindImageTexture = 0;
-PFNGLBINDIMAGETEXTURESPROC    COglExtensions::glBindImageTextures = 0;
-PFNGLBINDPROGRAMPIPELINEPROC    COglExtensions::glBindProgramPipeline = 0;
-PFNGLBINDRENDERBUFFERPROC    COglExtensions::glBindRenderbuffer = 0;
-PFNGLBINDSAMPLERPROC    COglExtensions::glBindSampler = 0;
-PFNGLBINDSAMPLERSPROC    COglExtensions::glBindSamplers = 0;
-PFNGLBINDTEXTURESPROC    COglExtensions::glBindTextures = 0;
-PFNGLBINDTEXTUREUNITPROC    COglExtensions::glBindTextureUnit = 0;
-PFNGLBINDTRANSFORMFEEDBACKPROC    COglExtensions::glBindTransformFeedback = 0;
-PFNGLBINDVERTEXARRAYPROC    COglExtensions::glBindVertexArray = 0;
-PFNGLBINDVERTEXBUFFERPROC    COglExtensions::glBindVertexBuffer = 0;
-PFNGLBINDVERTEXBUFFERSPROC    COglExtensions::glBindVertexBuffers = 0;
-PFNGLBLENDCOLORPROC    COglExtensions::glBlendColor = 0;
-PFNGLBLENDEQUATIONPROC    COglExtensions::glBlendEquation = 0;
-PFNGLBLENDEQUATIONIPROC    COglExtensions::glBlendEquationi = 0;
-PFNGLBLENDEQUATIONSEPARATEPROC    COglExtensions::glBlendEquationSeparate = 0;
-PFNGLBLENDEQUATIONSEPARATEIPROC    COglExtensions::glBlendEquationSeparatei = 0;
-PFNGLBLENDFUNCIPROC    COglExtensions::glBlendFunci = 0;
-PFNGLBLENDFUNCSEPARATEPROC    COglExtensions::glBlendFuncSeparate = 0;
-PFNGLBLENDFUNCSEPARATEIPROC    COglExtensions::glBlendFuncSeparatei = 0;
-PFNGLBLITFRAMEBUFFERPROC    COglExtensions::glBlitFramebuffer = 0;
-PFNGLBLITNAMEDFRAMEBUFFERPROC    COglExtensions::glBlitNamedFramebuffer = 0;
-PFNGLBUFFERDATAPROC    COglExtensions::glBufferData = 0;
-PFNGLBUFFERSTORAGEPROC    COglExtensions::glBufferStorage = 0;
-PFNGLBUFFERSUBDATAPROC    COglExtensions::glBufferSubData = 0;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC    COglExtensions::glCheckFramebufferStatus = 0;
-PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC    COglExtensions::glCheckNamedFramebufferStatus = 0;
-PFNGLCLAMPCOLORPROC    COglExtensions::glClampColor = 0;
-PFNGLCLEARBUFFERDATAPROC    COglExtensions::glClearBufferData = 0;
-PFNGLCLEARBUFFERFIPROC    COglExtensions::glClearBufferfi = 0;
-PFNGLCLEARBUFFERFVPROC    COglExtensions::glClearBufferfv = 0;
-PFNGLCLEARBUFFERIVPROC    COglExtensions::glClearBufferiv = 0;
-PFNGLCLEARBUFFERSUBDATAPROC    COglExtensions::glClearBufferSubData = 0;
-PFNGLCLEARBUFFERUIVPROC    COglExtensions::glClearBufferuiv = 0;
-PFNGLCLEARDEPTHFPROC    COglExtensions::glClearDepthf = 0;
-PFNGLCLEARNAMEDBUFFERDATAPROC    COglExtensions::glClearNamedBufferData = 0;
-PFNGLCLEARNAMEDBUFFERSUBDATAPROC    COglExtensions::glClearNamedBufferSubData = 0;
-PFNGLCLEARNAMEDFRAMEBUFFERFIPROC    COglExtensions::glClearNamedFramebufferfi = 0;
-PFNGLCLEARNAMEDFRAMEBUFFERFVPROC    COglExtensions::glClearNamedFramebufferfv = 0;
-PFNGLCLEARNAMEDFRAMEBUFFERIVPROC    COglExtensions::glClearNamedFramebufferiv = 0;
-PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC    COglExtensions::glClearNamedFramebufferuiv = 0;
-PFNGLCLEARTEXIMAGEPROC    COglExtensions::glClearTexImage = 0;
-PFNGLCLEARTEXSUBIMAGEPROC    COglExtensions::glClearTexSubImage = 0;
-PFNGLCLIENTACTIVETEXTUREPROC    COglExtensions::glClientActiveTexture = 0;
-PFNGLCLIENTWAITSYNCPROC    COglExtensions::glClientWaitSync = 0;
-PFNGLCLIPCONTROLPROC    COglExtensions::glClipControl = 0;
-PFNGLCOLORMASKIPROC    COglExtensions::glColorMaski = 0;
-PFNGLCOLORP3UIPROC    COglExtensions::glColorP3ui = 0;
-PFNGLCOLORP3UIVPROC    COglExtensions::glColorP3uiv = 0;
-PFNGLCOLORP4UIPROC    COglExtensions::glColorP4ui = 0;
-PFNGLCOLORP4UIVPROC    COglExtensions::glColorP4uiv = 0;
-PFNGLCOMPILESHADERPROC    COglExtensions::glCompileShader = 0;
-PFNGLCOMPILESHADERARBPROC    COglExtensions::glCompileShaderARB = 0;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC    COglExtensions::glCompressedTexImage1D = 0;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC    COglExtensions::glCompressedTexImage2D = 0;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC    COglExtensions::glCompressedTexImage3D = 0;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC    COglExtensions::glCompressedTexSubImage1D = 0;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC    COglExtensions::glCompressedTexSubImage2D = 0;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC    COglExtensions::glCompressedTexSubImage3D = 0;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC    COglExtensions::glCompressedTextureSubImage1D = 0;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC    COglExtensions::glCompressedTextureSubImage2D = 0;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC    COglExtensions::glCompressedTextureSubImage3D = 0;
-PFNGLCOPYBUFFERSUBDATAPROC    COglExtensions::glCopyBufferSubData = 0;
-PFNGLCOPYIMAGESUBDATAPROC    COglExtensions::glCopyImageSubData = 0;
-PFNGLCOPYNAMEDBUFFERSUBDATAPROC    COglExtensions::glCopyNamedBufferSubData = 0;
-PFNGLCOPYTEXSUBIMAGE3DPROC    COglExtensions::glCopyTexSubImage3D = 0;
-PFNGLCOPYTEXTURESUBIMAGE1DPROC    COglExtensions::glCopyTextureSubImage1D = 0;
-PFNGLCOPYTEXTURESUBIMAGE2DPROC    COglExtensions::glCopyTextureSubImage2D = 0;
-PFNGLCOPYTEXTURESUBIMAGE3DPROC    COglExtensions::glCopyTextureSubImage3D = 0;
-PFNGLCREATEBUFFERSPROC    COglExtensions::glCreateBuffers = 0;
-PFNGLCREATEFRAMEBUFFERSPROC    COglExtensions::glCreateFramebuffers = 0;
-PFNGLCREATEPROGRAMPROC    COglExtensions::glCreateProgram = 0;
-PFNGLCREATEPROGRAMOBJECTARBPROC    COglExtensions::glCreateProgramObjectARB = 0;
-PFNGLCREATEPROGRAMPIPELINESPROC    COglExtensions::glCreateProgramPipelines = 0;
-PFNGLCREATEQUERIESPROC    COglExtensions::glCreateQueries = 0;
-PFNGLCREATERENDERBUFFERSPROC    COglExtensions::glCreateRenderbuffers = 0;
-PFNGLCREATESAMPLERSPROC    COglExtensions::glCreateSamplers = 0;
-PFNGLCREATESHADERPROC    COglExtensions::glCreateShader = 0;
-PFNGLCREATESHADEROBJECTARBPROC    COglExtensions::glCreateShaderObjectARB = 0;
-PFNGLCREATESHADERPROGRAMVPROC    COglExtensions::glCreateShaderProgramv = 0;
-PFNGLCREATETEXTURESPROC    COglExtensions::glCreateTextures = 0;
-PFNGLCREATETRANSFORMFEEDBACKSPROC    COglExtensions::glCreateTransformFeedbacks = 0;
-PFNGLCREATEVERTEXARRAYSPROC    COglExtensions::glCreateVertexArrays = 0;
-PFNGLDEBUGMESSAGECALLBACKPROC    COglExtensions::glDebugMessageCallback = 0;
-PFNGLDEBUGMESSAGECONTROLPROC    COglExtensions::glDebugMessageControl = 0;
-PFNGLDEBUGMESSAGEINSERTPROC    COglExtensions::glDebugMessageInsert = 0;
-PFNGLDELETEBUFFERSPROC    COglExtensions::glDeleteBuffers = 0;
-PFNGLDELETEFRAMEBUFFERSPROC    COglExtensions::glDeleteFramebuffers = 0;
-PFNGLDELETEOBJECTARBPROC    COglExtensions::glDeleteObjectARB = 0;
-PFNGLDELETEPROGRAMPROC    COglExtensions::glDeleteProgram = 0;
-PFNGLDELETEPROGRAMPIPELINESPROC    COglExtensions::glDeleteProgramPipelines = 0;
-PFNGLDELETEQUERIESPROC    COglExtensions::glDeleteQueries = 0;
-PFNGLDELETERENDERBUFFERSPROC    COglExtensions::glDeleteRenderbuffers = 0;
-PFNGLDELETESAMPLERSPROC    COglExtensions::glDeleteSamplers = 0;
-PFNGLDELETESHADERPROC    COglExtensions::glDeleteShader = 0;
-PFNGLDELETESYNCPROC    COglExtensions::glDeleteSync = 0;
-PFNGLDELETETRANSFORMFEEDBACKSPROC    COglExtensions::glDeleteTransformFeedbacks = 0;
-PFNGLDELETEVERTEXARRAYSPROC    COglExtensions::glDeleteVertexArrays = 0;
-PFNGLDEPTHRANGEARRAYVPROC    COglExtensions::glDepthRangeArrayv = 0;
-PFNGLDEPTHRANGEFPROC    COglExtensions::glDepthRangef = 0;
-PFNGLDEPTHRANGEINDEXEDPROC    COglExtensions::glDepthRangeIndexed = 0;
-PFNGLDETACHOBJECTARBPROC    COglExtensions::glDetachObjectARB = 0;
-PFNGLDETACHSHADERPROC    COglExtensions::glDetachShader = 0;
-PFNGLDISABLEIPROC    COglExtensions::glDisablei = 0;
-PFNGLDISABLEVERTEXARRAYATTRIBPROC    COglExtensions::glDisableVertexArrayAttrib = 0;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC    COglExtensions::glDisableVertexAttribArray = 0;
-PFNGLDISPATCHCOMPUTEPROC    COglExtensions::glDispatchCompute = 0;
-PFNGLDISPATCHCOMPUTEINDIRECTPROC    COglExtensions::glDispatchComputeIndirect = 0;
-PFNGLDRAWARRAYSINDIRECTPROC    COglExtensions::glDrawArraysIndirect = 0;
-PFNGLDRAWARRAYSINSTANCEDPROC    COglExtensions::glDrawArraysInstanced = 0;
-PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC    COglExtensions::glDrawArraysInstancedBaseInstance = 0;
-PFNGLDRAWBUFFERSPROC    COglExtensions::glDrawBuffers = 0;
-PFNGLDRAWELEMENTSBASEVERTEXPROC    COglExtensions::glDrawElementsBaseVertex = 0;
-PFNGLDRAWELEMENTSINDIRECTPROC    COglExtensions::glDrawElementsIndirect = 0;
-PFNGLDRAWELEMENTSINSTANCEDPROC    COglExtensions::glDrawElementsInstanced = 0;
-PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC    COglExtensions::glDrawElementsInstancedBaseInstance = 0;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC    COglExtensions::glDrawElementsInstancedBaseVertex = 0;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC    COglExtensions::glDrawElementsInstancedBaseVertexBaseInstance = 0;
-PFNGLDRAWRANGEELEMENTSPROC    COglExtensions::glDrawRangeElements = 0;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC    COglExtensions::glDrawRangeElementsBaseVertex = 0;
-PFNGLDRAWTRANSFORMFEEDBACKPROC    COglExtensions::glDrawTransformFeedback = 0;
-PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC    COglExtensions::glDrawTransformFeedbackInstanced = 0;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC    COglExtensions::glDrawTransformFeedbackStream = 0;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC    COglExtensions::glDrawTransformFeedbackStreamInstanced = 0;
-PFNGLENABLEIPROC    COglExtensions::glEnablei = 0;
-PFNGLENABLEVERTEXARRAYATTRIBPROC    COglExtensions::glEnableVertexArrayAttrib = 0;
-PFNGLENABLEVERTEXATTRIBARRAYPROC    COglExtensions::glEnableVertexAttribArray = 0;
-PFNGLENDCONDITIONALRENDERPROC    COglExtensions::glEndConditionalRender = 0;
-PFNGLENDQUERYPROC    COglExtensions::glEndQuery = 0;
-PFNGLENDQUERYINDEXEDPROC    COglExtensions::glEndQueryIndexed = 0;
-PFNGLENDTRANSFORMFEEDBACKPROC    COglExtensions::glEndTransformFeedback = 0;
-PFNGLFENCESYNCPROC    COglExtensions::glFenceSync = 0;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC    COglExtensions::glFlushMappedBufferRange = 0;
-PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC    COglExtensions::glFlushMappedNamedBufferRange = 0;
-PFNGLFOGCOORDDPROC    COglExtensions::glFogCoordd = 0;
-PFNGLFOGCOORDDVPROC    COglExtensions::glFogCoorddv = 0;
-PFNGLFOGCOORDFPROC    COglExtensions::glFogCoordf = 0;
-PFNGLFOGCOORDFVPROC    COglExtensions::glFogCoordfv = 0;
-PFNGLFOGCOORDPOINTERPROC    COglExtensions::glFogCoordPointer = 0;
-PFNGLFRAMEBUFFERPARAMETERIPROC    COglExtensions::glFramebufferParameteri = 0;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC    COglExtensions::glFramebufferRenderbuffer = 0;
-PFNGLFRAMEBUFFERTEXTUREPROC    COglExtensions::glFramebufferTexture = 0;
-PFNGLFRAMEBUFFERTEXTURE1DPROC    COglExtensions::glFramebufferTexture1D = 0;
-PFNGLFRAMEBUFFERTEXTURE2DPROC    COglExtensions::glFramebufferTexture2D = 0;
-PFNGLFRAMEBUFFERTEXTURE3DPROC    COglExtensions::glFramebufferTexture3D = 0;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC    COglExtensions::glFramebufferTextureLayer = 0;
-PFNGLGENBUFFERSPROC    COglExtensions::glGenBuffers = 0;
-PFNGLGENERATEMIPMAPPROC    COglExtensions::glGenerateMipmap = 0;
-PFNGLGENERATETEXTUREMIPMAPPROC    COglExtensions::glGenerateTextureMipmap = 0;
-PFNGLGENFRAMEBUFFERSPROC    COglExtensions::glGenFramebuffers = 0;
-PFNGLGENPROGRAMPIPELINESPROC    COglExtensions::glGenProgramPipelines = 0;
-PFNGLGENQUERIESPROC    COglExtensions::glGenQueries = 0;
-PFNGLGENRENDERBUFFERSPROC    COglExtensions::glGenRenderbuffers = 0;
-PFNGLGENSAMPLERSPROC    COglExtensions::glGenSamplers = 0;
-PFNGLGENTRANSFORMFEEDBACKSPROC    COglExtensions::glGenTransformFeedbacks = 0;
-PFNGLGENVERTEXARRAYSPROC    COglExtensions::glGenVertexArrays = 0;
-PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC    COglExtensions::glGetActiveAtomicCounterBufferiv = 0;
-PFNGLGETACTIVEATTRIBPROC    COglExtensions::glGetActiveAttrib = 0;
-PFNGLGETACTIVESUBROUTINENAMEPROC    COglExtensions::glGetActiveSubroutineName = 0;
-PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC    COglExtensions::glGetActiveSubroutineUniformiv = 0;
-PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC    COglExtensions::glGetActiveSubroutineUniformName = 0;
-PFNGLGETACTIVEUNIFORMPROC    COglExtensions::glGetActiveUniform = 0;
-PFNGLGETACTIVEUNIFORMARBPROC    COglExtensions::glGetActiveUniformARB = 0;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC    COglExtensions::glGetActiveUniformBlockiv = 0;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC    COglExtensions::glGetActiveUniformBlockName = 0;
-PFNGLGETACTIVEUNIFORMNAMEPROC    COglExtensions::glGetActiveUniformName = 0;
-PFNGLGETACTIVEUNIFORMSIVPROC    COglExtensions::glGetActiveUniformsiv = 0;
-PFNGLGETATTACHEDOBJECTSARBPROC    COglExtensions::glGetAttachedObjectsARB = 0;
-PFNGLGETATTACHEDSHADERSPROC    COglExtensions::glGetAttachedShaders = 0;
-PFNGLGETATTRIBLOCATIONPROC    COglExtensions::glGetAttribLocation = 0;
-PFNGLGETBOOLEANI_VPROC    COglExtensions::glGetBooleani_v = 0;
-PFNGLGETBUFFERPARAMETERI64VPROC    COglExtensions::glGetBufferParameteri64v = 0;
-PFNGLGETBUFFERPARAMETERIVPROC    COglExtensions::glGetBufferParameteriv = 0;
-PFNGLGETBUFFERPOINTERVPROC    COglExtensions::glGetBufferPointerv = 0;
-PFNGLGETBUFFERSUBDATAPROC    COglExtensions::glGetBufferSubData = 0;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC    COglExtensions::glGetCompressedTexImage = 0;
-PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC    COglExtensions::glGetCompressedTextureImage = 0;
-PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC    COglExtensions::glGetCompressedTextureSubImage = 0;
-PFNGLGETDEBUGMESSAGELOGPROC    COglExtensions::glGetDebugMessageLog = 0;
-PFNGLGETDOUBLEI_VPROC    COglExtensions::glGetDoublei_v = 0;
-PFNGLGETFLOATI_VPROC    COglExtensions::glGetFloati_v = 0;
-PFNGLGETFRAGDATAINDEXPROC    COglExtensions::glGetFragDataIndex = 0;
-PFNGLGETFRAGDATALOCATIONPROC    COglExtensions::glGetFragDataLocation = 0;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC    COglExtensions::glGetFramebufferAttachmentParameteriv = 0;
-PFNGLGETFRAMEBUFFERPARAMETERIVPROC    COglExtensions::glGetFramebufferParameteriv = 0;
-PFNGLGETGRAPHICSRESETSTATUSPROC    COglExtensions::glGetGraphicsResetStatus = 0;
-PFNGLGETHANDLEARBPROC    COglExtensions::glGetHandleARB = 0;
-PFNGLGETINFOLOGARBPROC    COglExtensions::glGetInfoLogARB = 0;
-PFNGLGETINTEGER64I_VPROC    COglExtensions::glGetInteger64i_v = 0;
-PFNGLGETINTEGER64VPROC    COglExtensions::glGetInteger64v = 0;
-PFNGLGETINTEGERI_VPROC    COglExtensions::glGetIntegeri_v = 0;
-PFNGLGETINTERNALFORMATI64VPROC    COglExtensions::glGetInternalformati64v = 0;
-PFNGLGETINTERNALFORMATIVPROC    COglExtensions::glGetInternalformativ = 0;
-PFNGLGETMULTISAMPLEFVPROC    COglExtensions::glGetMultisamplefv = 0;
-PFNGLGETNAMEDBUFFERPARAMETERI64VPROC    COglExtensions::glGetNamedBufferParameteri64v = 0;
-PFNGLGETNAMEDBUFFERPARAMETERIVPROC    COglExtensions::glGetNamedBufferParameteriv = 0;
-PFNGLGETNAMEDBUFFERPOINTERVPROC    COglExtensions::glGetNamedBufferPointerv = 0;
-PFNGLGETNAMEDBUFFERSUBDATAPROC    COglExtensions::glGetNamedBufferSubData = 0;
-PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC    COglExtensions::glGetNamedFramebufferAttachmentParameteriv = 0;
-PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC    COglExtensions::glGetNamedFramebufferParameteriv = 0;
-PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC    COglExtensions::glGetNamedRenderbufferParameteriv = 0;
-//PFNGLGETNCOLORTABLEPROC    COglExtensions::glGetnColorTable = 0;
-PFNGLGETNCOMPRESSEDTEXIMAGEPROC    COglExtensions::glGetnCompressedTexImage = 0;
-//PFNGLGETNCONVOLUTIONFILTERPROC    COglExtensions::glGetnConvolutionFilter = 0;
-//PFNGLGETNHISTOGRAMPROC    COglExtensions::glGetnHistogram = 0;
-//PFNGLGETNMAPDVPROC    COglExtensions::glGetnMapdv = 0;
-//PFNGLGETNMAPFVPROC    COglExtensions::glGetnMapfv = 0;
-//PFNGLGETNMAPIVPROC    COglExtensions::glGetnMapiv = 0;
-//PFNGLGETNMINMAXPROC    COglExtensions::glGetnMinmax = 0;
-//PFNGLGETNPIXELMAPFVPROC    COglExtensions::glGetnPixelMapfv = 0;
-//PFNGLGETNPIXELMAPUIVPROC    COglExtensions::glGetnPixelMapuiv = 0;
-//PFNGLGETNPIXELMAPUSVPROC    COglExtensions::glGetnPixelMapusv = 0;
-PFNGLGETNPOLYGONSTIPPLEPROC    COglExtensions::glGetnPolygonStipple = 0;
-PFNGLGETNSEPARABLEFILTERPROC    COglExtensions::glGetnSeparableFilter = 0;
-PFNGLGETNTEXIMAGEPROC    COglExtensions::glGetnTexImage = 0;
-PFNGLGETNUNIFORMDVPROC    COglExtensions::glGetnUniformdv = 0;
-PFNGLGETNUNIFORMFVPROC    COglExtensions::glGetnUniformfv = 0;
-PFNGLGETNUNIFORMIVPROC    COglExtensions::glGetnUniformiv = 0;
-PFNGLGETNUNIFORMUIVPROC    COglExtensions::glGetnUniformuiv = 0;
-PFNGLGETOBJECTLABELPROC    COglExtensions::glGetObjectLabel = 0;
-PFNGLGETOBJECTPARAMETERFVARBPROC    COglExtensions::glGetObjectParameterfvARB = 0;
-PFNGLGETOBJECTPARAMETERIVARBPROC    COglExtensions::glGetObjectParameterivARB = 0;
-PFNGLGETOBJECTPTRLABELPROC    COglExtensions::glGetObjectPtrLabel = 0;
-PFNGLGETPROGRAMBINARYPROC    COglExtensions::glGetProgramBinary = 0;
-PFNGLGETPROGRAMINFOLOGPROC    COglExtensions::glGetProgramInfoLog = 0;
-PFNGLGETPROGRAMINTERFACEIVPROC    COglExtensions::glGetProgramInterfaceiv = 0;
-PFNGLGETPROGRAMIVPROC    COglExtensions::glGetProgramiv = 0;
-PFNGLGETPROGRAMPIPELINEINFOLOGPROC    COglExtensions::glGetProgramPipelineInfoLog = 0;
-PFNGLGETPROGRAMPIPELINEIVPROC    COglExtensions::glGetProgramPipelineiv = 0;
-PFNGLGETPROGRAMRESOURCEINDEXPROC    COglExtensions::glGetProgramResourceIndex = 0;
-PFNGLGETPROGRAMRESOURCEIVPROC    COglExtensions::glGetProgramResourceiv = 0;
-PFNGLGETPROGRAMRESOURCELOCATIONPROC    COglExtensions::glGetProgramResourceLocation = 0;
-PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC    COglExtensions::glGetProgramResourceLocationIndex = 0;
-PFNGLGETPROGRAMRESOURCENAMEPROC    COglExtensions::glGetProgramResourceName = 0;
-PFNGLGETPROGRAMSTAGEIVPROC    COglExtensions::glGetProgramStageiv = 0;
-PFNGLGETQUERYBUFFEROBJECTI64VPROC    COglExtensions::glGetQueryBufferObjecti64v = 0;
-PFNGLGETQUERYBUFFEROBJECTIVPROC    COglExtensions::glGetQueryBufferObjectiv = 0;
-PFNGLGETQUERYBUFFEROBJECTUI64VPROC    COglExtensions::glGetQueryBufferObjectui64v = 0;
-PFNGLGETQUERYBUFFEROBJECTUIVPROC    COglExtensions::glGetQueryBufferObjectuiv = 0;
-PFNGLGETQUERYINDEXEDIVPROC    COglExtensions::glGetQueryIndexediv = 0;
-PFNGLGETQUERYIVPROC    COglExtensions::glGetQueryiv = 0;
-PFNGLGETQUERYOBJECTI64VPROC    COglExtensions::glGetQueryObjecti64v = 0;
-PFNGLGETQUERYOBJECTIVPROC    COglExtensions::glGetQueryObjectiv = 0;
-PFNGLGETQUERYOBJECTUI64VPROC    COglExtensions::glGetQueryObjectui64v = 0;
-PFNGLGETQUERYOBJECTUIVPROC    COglExtensions::glGetQueryObjectuiv = 0;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC    COglExtensions::glGetRenderbufferParameteriv = 0;
-PFNGLGETSAMPLERPARAMETERFVPROC    COglExtensions::glGetSamplerParameterfv = 0;
-PFNGLGETSAMPLERPARAMETERIIVPROC    COglExtensions::glGetSamplerParameterIiv = 0;
-PFNGLGETSAMPLERPARAMETERIUIVPROC    COglExtensions::glGetSamplerParameterIuiv = 0;
-PFNGLGETSAMPLERPARAMETERIVPROC    COglExtensions::glGetSamplerParameteriv = 0;
-PFNGLGETSHADERINFOLOGPROC    COglExtensions::glGetShaderInfoLog = 0;
-PFNGLGETSHADERIVPROC    COglExtensions::glGetShaderiv = 0;
-PFNGLGETSHADERPRECISIONFORMATPROC    COglExtensions::glGetShaderPrecisionFormat = 0;
-PFNGLGETSHADERSOURCEPROC    COglExtensions::glGetShaderSource = 0;
-PFNGLGETSHADERSOURCEARBPROC    COglExtensions::glGetShaderSourceARB = 0;
-PFNGLGETSTRINGIPROC    COglExtensions::glGetStringi = 0;
-PFNGLGETSUBROUTINEINDEXPROC    COglExtensions::glGetSubroutineIndex = 0;
-PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC    COglExtensions::glGetSubroutineUniformLocation = 0;
-PFNGLGETSYNCIVPROC    COglExtensions::glGetSynciv = 0;
-PFNGLGETTEXPARAMETERIIVPROC    COglExtensions::glGetTexParameterIiv = 0;
-PFNGLGETTEXPARAMETERIUIVPROC    COglExtensions::glGetTexParameterIuiv = 0;
-PFNGLGETTEXTUREIMAGEPROC    COglExtensions::glGetTextureImage = 0;
-PFNGLGETTEXTURELEVELPARAMETERFVPROC    COglExtensions::glGetTextureLevelParameterfv = 0;
-PFNGLGETTEXTURELEVELPARAMETERIVPROC    COglExtensions::glGetTextureLevelParameteriv = 0;
-PFNGLGETTEXTUREPARAMETERFVPROC    COglExtensions::glGetTextureParameterfv = 0;
-PFNGLGETTEXTUREPARAMETERIIVPROC    COglExtensions::glGetTextureParameterIiv = 0;
-PFNGLGETTEXTUREPARAMETERIUIVPROC    COglExtensions::glGetTextureParameterIuiv = 0;
-PFNGLGETTEXTUREPARAMETERIVPROC    COglExtensions::glGetTextureParameteriv = 0;
-PFNGLGETTEXTURESUBIMAGEPROC    COglExtensions::glGetTextureSubImage = 0;
-PFNGLGETTRANSFORMFEEDBACKI64_VPROC    COglExtensions::glGetTransformFeedbacki64_v = 0;
-PFNGLGETTRANSFORMFEEDBACKI_VPROC    COglExtensions::glGetTransformFeedbacki_v = 0;
-PFNGLGETTRANSFORMFEEDBACKIVPROC    COglExtensions::glGetTransformFeedbackiv = 0;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC    COglExtensions::glGetTransformFeedbackVarying = 0;
-PFNGLGETUNIFORMBLOCKINDEXPROC    COglExtensions::glGetUniformBlockIndex = 0;
-PFNGLGETUNIFORMDVPROC    COglExtensions::glGetUniformdv = 0;
-PFNGLGETUNIFORMFVPROC    COglExtensions::glGetUniformfv = 0;
-PFNGLGETUNIFORMFVARBPROC    COglExtensions::glGetUniformfvARB = 0;
-PFNGLGETUNIFORMINDICESPROC    COglExtensions::glGetUniformIndices = 0;
-PFNGLGETUNIFORMIVPROC    COglExtensions::glGetUniformiv = 0;
-PFNGLGETUNIFORMIVARBPROC    COglExtensions::glGetUniformivARB = 0;
-PFNGLGETUNIFORMLOCATIONPROC    COglExtensions::glGetUniformLocation = 0;
-PFNGLGETUNIFORMLOCATIONARBPROC    COglExtensions::glGetUniformLocationARB = 0;
-PFNGLGETUNIFORMSUBROUTINEUIVPROC    COglExtensions::glGetUniformSubroutineuiv = 0;
-PFNGLGETUNIFORMUIVPROC    COglExtensions::glGetUniformuiv = 0;
-PFNGLGETVERTEXARRAYINDEXED64IVPROC    COglExtensions::glGetVertexArrayIndexed64iv = 0;
-PFNGLGETVERTEXARRAYINDEXEDIVPROC    COglExtensions::glGetVertexArrayIndexediv = 0;
-PFNGLGETVERTEXARRAYIVPROC    COglExtensions::glGetVertexArrayiv = 0;
-PFNGLGETVERTEXATTRIBDVPROC    COglExtensions::glGetVertexAttribdv = 0;
-PFNGLGETVERTEXATTRIBFVPROC    COglExtensions::glGetVertexAttribfv = 0;
-PFNGLGETVERTEXATTRIBIIVPROC    COglExtensions::glGetVertexAttribIiv = 0;
-PFNGLGETVERTEXATTRIBIUIVPROC    COglExtensions::glGetVertexAttribIuiv = 0;
-PFNGLGETVERTEXATTRIBIVPROC    COglExtensions::glGetVertexAttribiv = 0;
-PFNGLGETVERTEXATTRIBLDVPROC    COglExtensions::glGetVertexAttribLdv = 0;
-PFNGLGETVERTEXATTRIBPOINTERVPROC    COglExtensions::glGetVertexAttribPointerv = 0;
-PFNGLINVALIDATEBUFFERDATAPROC    COglExtensions::glInvalidateBufferData = 0;
-PFNGLINVALIDATEBUFFERSUBDATAPROC    COglExtensions::glInvalidateBufferSubData = 0;
-PFNGLINVALIDATEFRAMEBUFFERPROC    COglExtensions::glInvalidateFramebuffer = 0;
-PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC    COglExtensions::glInvalidateNamedFramebufferData = 0;
-PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC    COglExtensions::glInvalidateNamedFramebufferSubData = 0;
-PFNGLINVALIDATESUBFRAMEBUFFERPROC    COglExtensions::glInvalidateSubFramebuffer = 0;
-PFNGLINVALIDATETEXIMAGEPROC    COglExtensions::glInvalidateTexImage = 0;
-PFNGLINVALIDATETEXSUBIMAGEPROC    COglExtensions::glInvalidateTexSubImage = 0;
-PFNGLISBUFFERPROC    COglExtensions::glIsBuffer = 0;
-PFNGLISENABLEDIPROC    COglExtensions::glIsEnabledi = 0;
-PFNGLISFRAMEBUFFERPROC    COglExtensions::glIsFramebuffer = 0;
-PFNGLISPROGRAMPROC    COglExtensions::glIsProgram = 0;
-PFNGLISPROGRAMPIPELINEPROC    COglExtensions::glIsProgramPipeline = 0;
-PFNGLISQUERYPROC    COglExtensions::glIsQuery = 0;
-PFNGLISRENDERBUFFERPROC    COglExtensions::glIsRenderbuffer = 0;
-PFNGLISSAMPLERPROC    COglExtensions::glIsSampler = 0;
-PFNGLISSHADERPROC    COglExtensions::glIsShader = 0;
-PFNGLISSYNCPROC    COglExtensions::glIsSync = 0;
-PFNGLISTRANSFORMFEEDBACKPROC    COglExtensions::glIsTransformFeedback = 0;
-PFNGLISVERTEXARRAYPROC    COglExtensions::glIsVertexArray = 0;
-PFNGLLINKPROGRAMPROC    COglExtensions::glLinkProgram = 0;
-PFNGLLINKPROGRAMARBPROC    COglExtensions::glLinkProgramARB = 0;
-PFNGLLOADTRANSPOSEMATRIXDPROC    COglExtensions::glLoadTransposeMatrixd = 0;
-PFNGLLOADTRANSPOSEMATRIXFPROC    COglExtensions::glLoadTransposeMatrixf = 0;
-PFNGLMAPBUFFERPROC    COglExtensions::glMapBuffer = 0;
-PFNGLMAPBUFFERRANGEPROC    COglExtensions::glMapBufferRange = 0;
-PFNGLMAPNAMEDBUFFERPROC    COglExtensions::glMapNamedBuffer = 0;
-PFNGLMAPNAMEDBUFFERRANGEPROC    COglExtensions::glMapNamedBufferRange = 0;
-PFNGLMEMORYBARRIERPROC    COglExtensions::glMemoryBarrier = 0;
-PFNGLMEMORYBARRIERBYREGIONPROC    COglExtensions::glMemoryBarrierByRegion = 0;
-PFNGLMINSAMPLESHADINGPROC    COglExtensions::glMinSampleShading = 0;
-PFNGLMULTIDRAWARRAYSPROC    COglExtensions::glMultiDrawArrays = 0;
-PFNGLMULTIDRAWARRAYSINDIRECTPROC    COglExtensions::glMultiDrawArraysIndirect = 0;
-//PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC    COglExtensions::glMultiDrawArraysIndirectCount = 0;
-PFNGLMULTIDRAWELEMENTSPROC    COglExtensions::glMultiDrawElements = 0;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC    COglExtensions::glMultiDrawElementsBaseVertex = 0;
-PFNGLMULTIDRAWELEMENTSINDIRECTPROC    COglExtensions::glMultiDrawElementsIndirect = 0;
-//PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC    COglExtensions::glMultiDrawElementsIndirectCount = 0;
-PFNGLMULTITEXCOORD1DPROC    COglExtensions::glMultiTexCoord1d = 0;
-PFNGLMULTITEXCOORD1DVPROC    COglExtensions::glMultiTexCoord1dv = 0;
-PFNGLMULTITEXCOORD1FPROC    COglExtensions::glMultiTexCoord1f = 0;
-PFNGLMULTITEXCOORD1FVPROC    COglExtensions::glMultiTexCoord1fv = 0;
-PFNGLMULTITEXCOORD1IPROC    COglExtensions::glMultiTexCoord1i = 0;
-PFNGLMULTITEXCOORD1IVPROC    COglExtensions::glMultiTexCoord1iv = 0;
-PFNGLMULTITEXCOORD1SPROC    COglExtensions::glMultiTexCoord1s = 0;
-PFNGLMULTITEXCOORD1SVPROC    COglExtensions::glMultiTexCoord1sv = 0;
-PFNGLMULTITEXCOORD2DPROC    COglExtensions::glMultiTexCoord2d = 0;
-PFNGLMULTITEXCOORD2DVPROC    COglExtensions::glMultiTexCoord2dv = 0;
-PFNGLMULTITEXCOORD2FPROC    COglExtensions::glMultiTexCoord2f = 0;
-PFNGLMULTITEXCOORD2FVPROC    COglExtensions::glMultiTexCoord2fv = 0;
-PFNGLMULTITEXCOORD2IPROC    COglExtensions::glMultiTexCoord2i = 0;
-PFNGLMULTITEXCOORD2IVPROC    COglExtensions::glMultiTexCoord2iv = 0;
-PFNGLMULTITEXCOORD2SPROC    COglExtensions::glMultiTexCoord2s = 0;
-PFNGLMULTITEXCOORD2SVPROC    COglExtensions::glMultiTexCoord2sv = 0;
-PFNGLMULTITEXCOORD3DPROC    COglExtensions::glMultiTexCoord3d = 0;
-PFNGLMULTITEXCOORD3DVPROC    COglExtensions::glMultiTexCoord3dv = 0;
-PFNGLMULTITEXCOORD3FPROC    COglExtensions::glMultiTexCoord3f = 0;
-PFNGLMULTITEXCOORD3FVPROC    COglExtensions::glMultiTexCoord3fv = 0;
-PFNGLMULTITEXCOORD3IPROC    COglExtensions::glMultiTexCoord3i = 0;
-PFNGLMULTITEXCOORD3IVPROC    COglExtensions::glMultiTexCoord3iv = 0;
-PFNGLMULTITEXCOORD3SPROC    COglExtensions::glMultiTexCoord3s = 0;
-PFNGLMULTITEXCOORD3SVPROC    COglExtensions::glMultiTexCoord3sv = 0;
-PFNGLMULTITEXCOORD4DPROC    COglExtensions::glMultiTexCoord4d = 0;
-PFNGLMULTITEXCOORD4DVPROC    COglExtensions::glMultiTexCoord4dv = 0;
-PFNGLMULTITEXCOORD4FPROC    COglExtensions::glMultiTexCoord4f = 0;
-PFNGLMULTITEXCOORD4FVPROC    COglExtensions::glMultiTexCoord4fv = 0;
-PFNGLMULTITEXCOORD4IPROC    COglExtensions::glMultiTexCoord4i = 0;
-PFNGLMULTITEXCOORD4IVPROC    COglExtensions::glMultiTexCoord4iv = 0;
-PFNGLMULTITEXCOORD4SPROC    COglExtensions::glMultiTexCoord4s = 0;
-PFNGLMULTITEXCOORD4SVPROC    COglExtensions::glMultiTexCoord4sv = 0;
-PFNGLMULTITEXCOORDP1UIPROC    COglExtensions::glMultiTexCoordP1ui = 0;
-PFNGLMULTITEXCOORDP1UIVPROC    COglExtensions::glMultiTexCoordP1uiv = 0;
-PFNGLMULTITEXCOORDP2UIPROC    COglExtensions::glMultiTexCoordP2ui = 0;
-PFNGLMULTITEXCOORDP2UIVPROC    COglExtensions::glMultiTexCoordP2uiv = 0;
-PFNGLMULTITEXCOORDP3UIPROC    COglExtensions::glMultiTexCoordP3ui = 0;
-PFNGLMULTITEXCOORDP3UIVPROC    COglExtensions::glMultiTexCoordP3uiv = 0;
-PFNGLMULTITEXCOORDP4UIPROC    COglExtensions::glMultiTexCoordP4ui = 0;
-PFNGLMULTITEXCOORDP4UIVPROC    COglExtensions::glMultiTexCoordP4uiv = 0;
-PFNGLMULTTRANSPOSEMATRIXDPROC    COglExtensions::glMultTransposeMatrixd = 0;
-PFNGLMULTTRANSPOSEMATRIXFPROC    COglExtensions::glMultTransposeMatrixf = 0;
-PFNGLNAMEDBUFFERDATAPROC    COglExtensions::glNamedBufferData = 0;
-PFNGLNAMEDBUFFERSTORAGEPROC    COglExtensions::glNamedBufferStorage = 0;
-PFNGLNAMEDBUFFERSUBDATAPROC    COglExtensions::glNamedBufferSubData = 0;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC    COglExtensions::glNamedFramebufferDrawBuffer = 0;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC    COglExtensions::glNamedFramebufferDrawBuffers = 0;
-PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC    COglExtensions::glNamedFramebufferParameteri = 0;
-PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC    COglExtensions::glNamedFramebufferReadBuffer = 0;
-PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC    COglExtensions::glNamedFramebufferRenderbuffer = 0;
-PFNGLNAMEDFRAMEBUFFERTEXTUREPROC    COglExtensions::glNamedFramebufferTexture = 0;
-PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC    COglExtensions::glNamedFramebufferTextureLayer = 0;
-PFNGLNAMEDRENDERBUFFERSTORAGEPROC    COglExtensions::glNamedRenderbufferStorage = 0;
-PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC    COglExtensions::glNamedRenderbufferStorageMultisample = 0;
-PFNGLNORMALP3UIPROC    COglExtensions::glNormalP3ui = 0;
-PFNGLNORMALP3UIVPROC    COglExtensions::glNormalP3uiv = 0;
-PFNGLOBJECTLABELPROC    COglExtensions::glObjectLabel = 0;
-PFNGLOBJECTPTRLABELPROC    COglExtensions::glObjectPtrLabel = 0;
-PFNGLPATCHPARAMETERFVPROC    COglExtensions::glPatchParameterfv = 0;
-PFNGLPATCHPARAMETERIPROC    COglExtensions::glPatchParameteri = 0;
-PFNGLPAUSETRANSFORMFEEDBACKPROC    COglExtensions::glPauseTransformFeedback = 0;
-PFNGLPOINTPARAMETERFPROC    COglExtensions::glPointParameterf = 0;
-PFNGLPOINTPARAMETERFVPROC    COglExtensions::glPointParameterfv = 0;
-PFNGLPOINTPARAMETERIPROC    COglExtensions::glPointParameteri = 0;
-PFNGLPOINTPARAMETERIVPROC    COglExtensions::glPointParameteriv = 0;
-PFNGLPOLYGONOFFSETCLAMPPROC    COglExtensions::glPolygonOffsetClamp = 0;
-PFNGLPOPDEBUGGROUPPROC    COglExtensions::glPopDebugGroup = 0;
-PFNGLPRIMITIVERESTARTINDEXPROC    COglExtensions::glPrimitiveRestartIndex = 0;
-PFNGLPROGRAMBINARYPROC    COglExtensions::glProgramBinary = 0;
-PFNGLPROGRAMPARAMETERIPROC    COglExtensions::glProgramParameteri = 0;
-PFNGLPROGRAMPARAMETERIEXTPROC    COglExtensions::glProgramParameteriEXT = 0;
-PFNGLPROGRAMUNIFORM1DPROC    COglExtensions::glProgramUniform1d = 0;
-PFNGLPROGRAMUNIFORM1DVPROC    COglExtensions::glProgramUniform1dv = 0;
-PFNGLPROGRAMUNIFORM1FPROC    COglExtensions::glProgramUniform1f = 0;
-PFNGLPROGRAMUNIFORM1FVPROC    COglExtensions::glProgramUniform1fv = 0;
-PFNGLPROGRAMUNIFORM1IPROC    COglExtensions::glProgramUniform1i = 0;
-PFNGLPROGRAMUNIFORM1IVPROC    COglExtensions::glProgramUniform1iv = 0;
-PFNGLPROGRAMUNIFORM1UIPROC    COglExtensions::glProgramUniform1ui = 0;
-PFNGLPROGRAMUNIFORM1UIVPROC    COglExtensions::glProgramUniform1uiv = 0;
-PFNGLPROGRAMUNIFORM2DPROC    COglExtensions::glProgramUniform2d = 0;
-PFNGLPROGRAMUNIFORM2DVPROC    COglExtensions::glProgramUniform2dv = 0;
-PFNGLPROGRAMUNIFORM2FPROC    COglExtensions::glProgramUniform2f = 0;
-PFNGLPROGRAMUNIFORM2FVPROC    COglExtensions::glProgramUniform2fv = 0;
-PFNGLPROGRAMUNIFORM2IPROC    COglExtensions::glProgramUniform2i = 0;
-PFNGLPROGRAMUNIFORM2IVPROC    COglExtensions::glProgramUniform2iv = 0;
-PFNGLPROGRAMUNIFORM2UIPROC    COglExtensions::glProgramUniform2ui = 0;
-PFNGLPROGRAMUNIFORM2UIVPROC    COglExtensions::glProgramUniform2uiv = 0;
-PFNGLPROGRAMUNIFORM3DPROC    COglExtensions::glProgramUniform3d = 0;
-PFNGLPROGRAMUNIFORM3DVPROC    COglExtensions::glProgramUniform3dv = 0;
-PFNGLPROGRAMUNIFORM3FPROC    COglExtensions::glProgramUniform3f = 0;
-PFNGLPROGRAMUNIFORM3FVPROC    COglExtensions::glProgramUniform3fv = 0;
-PFNGLPROGRAMUNIFORM3IPROC    COglExtensions::glProgramUniform3i = 0;
-PFNGLPROGRAMUNIFORM3IVPROC    COglExtensions::glProgramUniform3iv = 0;
-PFNGLPROGRAMUNIFORM3UIPROC    COglExtensions::glProgramUniform3ui = 0;
-PFNGLPROGRAMUNIFORM3UIVPROC    COglExtensions::glProgramUniform3uiv = 0;
-PFNGLPROGRAMUNIFORM4DPROC    COglExtensions::glProgramUniform4d = 0;
-PFNGLPROGRAMUNIFORM4DVPROC    COglExtensions::glProgramUniform4dv = 0;
-PFNGLPROGRAMUNIFORM4FPROC    COglExtensions::glProgramUniform4f = 0;
-PFNGLPROGRAMUNIFORM4FVPROC    COglExtensions::glProgramUniform4fv = 0;
-PFNGLPROGRAMUNIFORM4IPROC    COglExtensions::glProgramUniform4i = 0;
-PFNGLPROGRAMUNIFORM4IVPROC    COglExtensions::glProgramUniform4iv = 0;
-PFNGLPROGRAMUNIFORM4UIPROC    COglExtensions::glProgramUniform4ui = 0;
-PFNGLPROGRAMUNIFORM4UIVPROC    COglExtensions::glProgramUniform4uiv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2DVPROC    COglExtensions::glProgramUniformMatrix2dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2FVPROC    COglExtensions::glProgramUniformMatrix2fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC    COglExtensions::glProgramUniformMatrix2x3dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC    COglExtensions::glProgramUniformMatrix2x3fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC    COglExtensions::glProgramUniformMatrix2x4dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC    COglExtensions::glProgramUniformMatrix2x4fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3DVPROC    COglExtensions::glProgramUniformMatrix3dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3FVPROC    COglExtensions::glProgramUniformMatrix3fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC    COglExtensions::glProgramUniformMatrix3x2dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC    COglExtensions::glProgramUniformMatrix3x2fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC    COglExtensions::glProgramUniformMatrix3x4dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC    COglExtensions::glProgramUniformMatrix3x4fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4DVPROC    COglExtensions::glProgramUniformMatrix4dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4FVPROC    COglExtensions::glProgramUniformMatrix4fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC    COglExtensions::glProgramUniformMatrix4x2dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC    COglExtensions::glProgramUniformMatrix4x2fv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC    COglExtensions::glProgramUniformMatrix4x3dv = 0;
-PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC    COglExtensions::glProgramUniformMatrix4x3fv = 0;
-PFNGLPROVOKINGVERTEXPROC    COglExtensions::glProvokingVertex = 0;
-PFNGLPUSHDEBUGGROUPPROC    COglExtensions::glPushDebugGroup = 0;
-PFNGLQUERYCOUNTERPROC    COglExtensions::glQueryCounter = 0;
-PFNGLREADNPIXELSPROC    COglExtensions::glReadnPixels = 0;
-PFNGLRELEASESHADERCOMPILERPROC    COglExtensions::glReleaseShaderCompiler = 0;
-PFNGLRENDERBUFFERSTORAGEPROC    COglExtensions::glRenderbufferStorage = 0;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC    COglExtensions::glRenderbufferStorageMultisample = 0;
-PFNGLRESUMETRANSFORMFEEDBACKPROC    COglExtensions::glResumeTransformFeedback = 0;
-PFNGLSAMPLECOVERAGEPROC    COglExtensions::glSampleCoverage = 0;
-PFNGLSAMPLEMASKIPROC    COglExtensions::glSampleMaski = 0;
-PFNGLSAMPLERPARAMETERFPROC    COglExtensions::glSamplerParameterf = 0;
-PFNGLSAMPLERPARAMETERFVPROC    COglExtensions::glSamplerParameterfv = 0;
-PFNGLSAMPLERPARAMETERIPROC    COglExtensions::glSamplerParameteri = 0;
-PFNGLSAMPLERPARAMETERIIVPROC    COglExtensions::glSamplerParameterIiv = 0;
-PFNGLSAMPLERPARAMETERIUIVPROC    COglExtensions::glSamplerParameterIuiv = 0;
-PFNGLSAMPLERPARAMETERIVPROC    COglExtensions::glSamplerParameteriv = 0;
-PFNGLSCISSORARRAYVPROC    COglExtensions::glScissorArrayv = 0;
-PFNGLSCISSORINDEXEDPROC    COglExtensions::glScissorIndexed = 0;
-PFNGLSCISSORINDEXEDVPROC    COglExtensions::glScissorIndexedv = 0;
-PFNGLSECONDARYCOLOR3BPROC    COglExtensions::glSecondaryColor3b = 0;
-PFNGLSECONDARYCOLOR3BVPROC    COglExtensions::glSecondaryColor3bv = 0;
-PFNGLSECONDARYCOLOR3DPROC    COglExtensions::glSecondaryColor3d = 0;
-PFNGLSECONDARYCOLOR3DVPROC    COglExtensions::glSecondaryColor3dv = 0;
-PFNGLSECONDARYCOLOR3FPROC    COglExtensions::glSecondaryColor3f = 0;
-PFNGLSECONDARYCOLOR3FVPROC    COglExtensions::glSecondaryColor3fv = 0;
-PFNGLSECONDARYCOLOR3IPROC    COglExtensions::glSecondaryColor3i = 0;
-PFNGLSECONDARYCOLOR3IVPROC    COglExtensions::glSecondaryColor3iv = 0;
-PFNGLSECONDARYCOLOR3SPROC    COglExtensions::glSecondaryColor3s = 0;
-PFNGLSECONDARYCOLOR3SVPROC    COglExtensions::glSecondaryColor3sv = 0;
-PFNGLSECONDARYCOLOR3UBPROC    COglExtensions::glSecondaryColor3ub = 0;
-PFNGLSECONDARYCOLOR3UBVPROC    COglExtensions::glSecondaryColor3ubv = 0;
-PFNGLSECONDARYCOLOR3UIPROC    COglExtensions::glSecondaryColor3ui = 0;
-PFNGLSECONDARYCOLOR3UIVPROC    COglExtensions::glSecondaryColor3uiv = 0;
-PFNGLSECONDARYCOLOR3USPROC    COglExtensions::glSecondaryColor3us = 0;
-PFNGLSECONDARYCOLOR3USVPROC    COglExtensions::glSecondaryColor3usv = 0;
-PFNGLSECONDARYCOLORP3UIPROC    COglExtensions::glSecondaryColorP3ui = 0;
-PFNGLSECONDARYCOLORP3UIVPROC    COglExtensions::glSecondaryColorP3uiv = 0;
-PFNGLSECONDARYCOLORPOINTERPROC    COglExtensions::glSecondaryColorPointer = 0;
-PFNGLSHADERBINARYPROC    COglExtensions::glShaderBinary = 0;
-PFNGLSHADERSOURCEPROC    COglExtensions::glShaderSource = 0;
-PFNGLSHADERSOURCEARBPROC    COglExtensions::glShaderSourceARB = 0;
-PFNGLSHADERSTORAGEBLOCKBINDINGPROC    COglExtensions::glShaderStorageBlockBinding = 0;
-PFNGLSPECIALIZESHADERPROC    COglExtensions::glSpecializeShader = 0;
-PFNGLSTENCILFUNCSEPARATEPROC    COglExtensions::glStencilFuncSeparate = 0;
-PFNGLSTENCILMASKSEPARATEPROC    COglExtensions::glStencilMaskSeparate = 0;
-PFNGLSTENCILOPSEPARATEPROC    COglExtensions::glStencilOpSeparate = 0;
-PFNGLTEXBUFFERPROC    COglExtensions::glTexBuffer = 0;
-PFNGLTEXBUFFERRANGEPROC    COglExtensions::glTexBufferRange = 0;
-PFNGLTEXCOORDP1UIPROC    COglExtensions::glTexCoordP1ui = 0;
-PFNGLTEXCOORDP1UIVPROC    COglExtensions::glTexCoordP1uiv = 0;
-PFNGLTEXCOORDP2UIPROC    COglExtensions::glTexCoordP2ui = 0;
-PFNGLTEXCOORDP2UIVPROC    COglExtensions::glTexCoordP2uiv = 0;
-PFNGLTEXCOORDP3UIPROC    COglExtensions::glTexCoordP3ui = 0;
-PFNGLTEXCOORDP3UIVPROC    COglExtensions::glTexCoordP3uiv = 0;
-PFNGLTEXCOORDP4UIPROC    COglExtensions::glTexCoordP4ui = 0;
-PFNGLTEXCOORDP4UIVPROC    COglExtensions::glTexCoordP4uiv = 0;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC    COglExtensions::glTexImage2DMultisample = 0;
-PFNGLTEXIMAGE3DPROC    COglExtensions::glTexImage3D = 0;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC    COglExtensions::glTexImage3DMultisample = 0;
-PFNGLTEXPARAMETERIIVPROC    COglExtensions::glTexParameterIiv = 0;
-PFNGLTEXPARAMETERIUIVPROC    COglExtensions::glTexParameterIuiv = 0;
-PFNGLTEXSTORAGE1DPROC    COglExtensions::glTexStorage1D = 0;
-PFNGLTEXSTORAGE2DPROC    COglExtensions::glTexStorage2D = 0;
-PFNGLTEXSTORAGE2DMULTISAMPLEPROC    COglExtensions::glTexStorage2DMultisample = 0;
-PFNGLTEXSTORAGE3DPROC    COglExtensions::glTexStorage3D = 0;
-PFNGLTEXSTORAGE3DMULTISAMPLEPROC    COglExtensions::glTexStorage3DMultisample = 0;
-PFNGLTEXSUBIMAGE3DPROC    COglExtensions::glTexSubImage3D = 0;
-PFNGLTEXTUREBARRIERPROC    COglExtensions::glTextureBarrier = 0;
-PFNGLTEXTUREBUFFERPROC    COglExtensions::glTextureBuffer = 0;
-PFNGLTEXTUREBUFFERRANGEPROC    COglExtensions::glTextureBufferRange = 0;
-PFNGLTEXTUREPARAMETERFPROC    COglExtensions::glTextureParameterf = 0;
-PFNGLTEXTUREPARAMETERFVPROC    COglExtensions::glTextureParameterfv = 0;
-PFNGLTEXTUREPARAMETERIPROC    COglExtensions::glTextureParameteri = 0;
-PFNGLTEXTUREPARAMETERIIVPROC    COglExtensions::glTextureParameterIiv = 0;
-PFNGLTEXTUREPARAMETERIUIVPROC    COglExtensions::glTextureParameterIuiv = 0;
-PFNGLTEXTUREPARAMETERIVPROC    COglExtensions::glTextureParameteriv = 0;
-PFNGLTEXTURESTORAGE1DPROC    COglExtensions::glTextureStorage1D = 0;
-PFNGLTEXTURESTORAGE2DPROC    COglExtensions::glTextureStorage2D = 0;
-PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC    COglExtensions::glTextureStorage2DMultisample = 0;
-PFNGLTEXTURESTORAGE3DPROC    COglExtensions::glTextureStorage3D = 0;
-PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC    COglExtensions::glTextureStorage3DMultisample = 0;
-PFNGLTEXTURESUBIMAGE1DPROC    COglExtensions::glTextureSubImage1D = 0;
-PFNGLTEXTURESUBIMAGE2DPROC    COglExtensions::glTextureSubImage2D = 0;
-PFNGLTEXTURESUBIMAGE3DPROC    COglExtensions::glTextureSubImage3D = 0;
-PFNGLTEXTUREVIEWPROC    COglExtensions::glTextureView = 0;
-PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC    COglExtensions::glTransformFeedbackBufferBase = 0;
-PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC    COglExtensions::glTransformFeedbackBufferRange = 0;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC    COglExtensions::glTransformFeedbackVaryings = 0;
-PFNGLUNIFORM1DPROC    COglExtensions::glUniform1d = 0;
-PFNGLUNIFORM1DVPROC    COglExtensions::glUniform1dv = 0;
-PFNGLUNIFORM1FPROC    COglExtensions::glUniform1f = 0;
-PFNGLUNIFORM1FARBPROC    COglExtensions::glUniform1fARB = 0;
-PFNGLUNIFORM1FVPROC    COglExtensions::glUniform1fv = 0;
-PFNGLUNIFORM1FVARBPROC    COglExtensions::glUniform1fvARB = 0;
-PFNGLUNIFORM1IPROC    COglExtensions::glUniform1i = 0;
-PFNGLUNIFORM1IARBPROC    COglExtensions::glUniform1iARB = 0;
-PFNGLUNIFORM1IVPROC    COglExtensions::glUniform1iv = 0;
-PFNGLUNIFORM1IVARBPROC    COglExtensions::glUniform1ivARB = 0;
-PFNGLUNIFORM1UIPROC    COglExtensions::glUniform1ui = 0;
-PFNGLUNIFORM1UIVPROC    COglExtensions::glUniform1uiv = 0;
-PFNGLUNIFORM2DPROC    COglExtensions::glUniform2d = 0;
-PFNGLUNIFORM2DVPROC    COglExtensions::glUniform2dv = 0;
-PFNGLUNIFORM2FPROC    COglExtensions::glUniform2f = 0;
-PFNGLUNIFORM2FARBPROC    COglExtensions::glUniform2fARB = 0;
-PFNGLUNIFORM2FVPROC    COglExtensions::glUniform2fv = 0;
-PFNGLUNIFORM2FVARBPROC    COglExtensions::glUniform2fvARB = 0;
-PFNGLUNIFORM2IPROC    COglExtensions::glUniform2i = 0;
-PFNGLUNIFORM2IARBPROC    COglExtensions::glUniform2iARB = 0;
-PFNGLUNIFORM2IVPROC    COglExtensions::glUniform2iv = 0;
-PFNGLUNIFORM2IVARBPROC    COglExtensions::glUniform2ivARB = 0;
-PFNGLUNIFORM2UIPROC    COglExtensions::glUniform2ui = 0;
-PFNGLUNIFORM2UIVPROC    COglExtensions::glUniform2uiv = 0;
-PFNGLUNIFORM3DPROC    COglExtensions::glUniform3d = 0;
-PFNGLUNIFORM3DVPROC    COglExtensions::glUniform3dv = 0;
-PFNGLUNIFORM3FPROC    COglExtensions::glUniform3f = 0;
-PFNGLUNIFORM3FARBPROC    COglExtensions::glUniform3fARB = 0;
-PFNGLUNIFORM3FVPROC    COglExtensions::glUniform3fv = 0;
-PFNGLUNIFORM3FVARBPROC    COglExtensions::glUniform3fvARB = 0;
-PFNGLUNIFORM3IPROC    COglExtensions::glUniform3i = 0;
-PFNGLUNIFORM3IARBPROC    COglExtensions::glUniform3iARB = 0;
-PFNGLUNIFORM3IVPROC    COglExtensions::glUniform3iv = 0;
-PFNGLUNIFORM3IVARBPROC    COglExtensions::glUniform3ivARB = 0;
-PFNGLUNIFORM3UIPROC    COglExtensions::glUniform3ui = 0;
-PFNGLUNIFORM3UIVPROC    COglExtensions::glUniform3uiv = 0;
-PFNGLUNIFORM4DPROC    COglExtensions::glUniform4d = 0;
-PFNGLUNIFORM4DVPROC    COglExtensions::glUniform4dv = 0;
-PFNGLUNIFORM4FPROC    COglExtensions::glUniform4f = 0;
-PFNGLUNIFORM4FARBPROC    COglExtensions::glUniform4fARB = 0;
-PFNGLUNIFORM4FVPROC    COglExtensions::glUniform4fv = 0;
-PFNGLUNIFORM4FVARBPROC    COglExtensions::glUniform4fvARB = 0;
-PFNGLUNIFORM4IPROC    COglExtensions::glUniform4i = 0;
-PFNGLUNIFORM4IARBPROC    COglExtensions::glUniform4iARB = 0;
-PFNGLUNIFORM4IVPROC    COglExtensions::glUniform4iv = 0;
-PFNGLUNIFORM4IVARBPROC    COglExtensions::glUniform4ivARB = 0;
-PFNGLUNIFORM4UIPROC    COglExtensions::glUniform4ui = 0;
-PFNGLUNIFORM4UIVPROC    COglExtensions::glUniform4uiv = 0;
-PFNGLUNIFORMBLOCKBINDINGPROC    COglExtensions::glUniformBlockBinding = 0;
-PFNGLUNIFORMMATRIX2DVPROC    COglExtensions::glUniformMatrix2dv = 0;
-PFNGLUNIFORMMATRIX2FVPROC    COglExtensions::glUniformMatrix2fv = 0;
-PFNGLUNIFORMMATRIX2FVARBPROC    COglExtensions::glUniformMatrix2fvARB = 0;
-PFNGLUNIFORMMATRIX2X3DVPROC    COglExtensions::glUniformMatrix2x3dv = 0;
-PFNGLUNIFORMMATRIX2X3FVPROC    COglExtensions::glUniformMatrix2x3fv = 0;
-PFNGLUNIFORMMATRIX2X4DVPROC    COglExtensions::glUniformMatrix2x4dv = 0;
-PFNGLUNIFORMMATRIX2X4FVPROC    COglExtensions::glUniformMatrix2x4fv = 0;
-PFNGLUNIFORMMATRIX3DVPROC    COglExtensions::glUniformMatrix3dv = 0;
-PFNGLUNIFORMMATRIX3FVPROC    COglExtensions::glUniformMatrix3fv = 0;
-PFNGLUNIFORMMATRIX3FVARBPROC    COglExtensions::glUniformMatrix3fvARB = 0;
-PFNGLUNIFORMMATRIX3X2DVPROC    COglExtensions::glUniformMatrix3x2dv = 0;
-PFNGLUNIFORMMATRIX3X2FVPROC    COglExtensions::glUniformMatrix3x2fv = 0;
-PFNGLUNIFORMMATRIX3X4DVPROC    COglExtensions::glUniformMatrix3x4dv = 0;
-PFNGLUNIFORMMATRIX3X4FVPROC    COglExtensions::glUniformMatrix3x4fv = 0;
-PFNGLUNIFORMMATRIX4DVPROC    COglExtensions::glUniformMatrix4dv = 0;
-PFNGLUNIFORMMATRIX4FVPROC    COglExtensions::glUniformMatrix4fv = 0;
-PFNGLUNIFORMMATRIX4FVARBPROC    COglExtensions::glUniformMatrix4fvARB = 0;
-PFNGLUNIFORMMATRIX4X2DVPROC    COglExtensions::glUniformMatrix4x2dv = 0;
-PFNGLUNIFORMMATRIX4X2FVPROC    COglExtensions::glUniformMatrix4x2fv = 0;
-PFNGLUNIFORMMATRIX4X3DVPROC    COglExtensions::glUniformMatrix4x3dv = 0;
-PFNGLUNIFORMMATRIX4X3FVPROC    COglExtensions::glUniformMatrix4x3fv = 0;
-PFNGLUNIFORMSUBROUTINESUIVPROC    COglExtensions::glUniformSubroutinesuiv = 0;
-PFNGLUNMAPBUFFERPROC    COglExtensions::glUnmapBuffer = 0;
-PFNGLUNMAPNAMEDBUFFERPROC    COglExtensions::glUnmapNamedBuffer = 0;
-PFNGLUSEPROGRAMPROC    COglExtensions::glUseProgram = 0;
-PFNGLUSEPROGRAMOBJECTARBPROC    COglExtensions::glUseProgramObjectARB = 0;
-PFNGLUSEPROGRAMSTAGESPROC    COglExtensions::glUseProgramStages = 0;
-PFNGLVALIDATEPROGRAMPROC    COglExtensions::glValidateProgram = 0;
-PFNGLVALIDATEPROGRAMARBPROC    COglExtensions::glValidateProgramARB = 0;
-PFNGLVALIDATEPROGRAMPIPELINEPROC    COglExtensions::glValidateProgramPipeline = 0;
-PFNGLVERTEXARRAYATTRIBBINDINGPROC    COglExtensions::glVertexArrayAttribBinding = 0;
-PFNGLVERTEXARRAYATTRIBFORMATPROC    COglExtensions::glVertexArrayAttribFormat = 0;
-PFNGLVERTEXARRAYATTRIBIFORMATPROC    COglExtensions::glVertexArrayAttribIFormat = 0;
-PFNGLVERTEXARRAYATTRIBLFORMATPROC    COglExtensions::glVertexArrayAttribLFormat = 0;
-PFNGLVERTEXARRAYBINDINGDIVISORPROC    COglExtensions::glVertexArrayBindingDivisor = 0;
-PFNGLVERTEXARRAYELEMENTBUFFERPROC    COglExtensions::glVertexArrayElementBuffer = 0;
-PFNGLVERTEXARRAYVERTEXBUFFERPROC    COglExtensions::glVertexArrayVertexBuffer = 0;
-PFNGLVERTEXARRAYVERTEXBUFFERSPROC    COglExtensions::glVertexArrayVertexBuffers = 0;
-PFNGLVERTEXATTRIB1DPROC    COglExtensions::glVertexAttrib1d = 0;
-PFNGLVERTEXATTRIB1DVPROC    COglExtensions::glVertexAttrib1dv = 0;
-PFNGLVERTEXATTRIB1FPROC    COglExtensions::glVertexAttrib1f = 0;
-PFNGLVERTEXATTRIB1FVPROC    COglExtensions::glVertexAttrib1fv = 0;
-PFNGLVERTEXATTRIB1SPROC    COglExtensions::glVertexAttrib1s = 0;
-PFNGLVERTEXATTRIB1SVPROC    COglExtensions::glVertexAttrib1sv = 0;
-PFNGLVERTEXATTRIB2DPROC    COglExtensions::glVertexAttrib2d = 0;
-PFNGLVERTEXATTRIB2DVPROC    COglExtensions::glVertexAttrib2dv = 0;
-PFNGLVERTEXATTRIB2FPROC    COglExtensions::glVertexAttrib2f = 0;
-PFNGLVERTEXATTRIB2FVPROC    COglExtensions::glVertexAttrib2fv = 0;
-PFNGLVERTEXATTRIB2SPROC    COglExtensions::glVertexAttrib2s = 0;
-PFNGLVERTEXATTRIB2SVPROC    COglExtensions::glVertexAttrib2sv = 0;
-PFNGLVERTEXATTRIB3DPROC    COglExtensions::glVertexAttrib3d = 0;
-PFNGLVERTEXATTRIB3DVPROC    COglExtensions::glVertexAttrib3dv = 0;
-PFNGLVERTEXATTRIB3FPROC    COglExtensions::glVertexAttrib3f = 0;
-PFNGLVERTEXATTRIB3FVPROC    COglExtensions::glVertexAttrib3fv = 0;
-PFNGLVERTEXATTRIB3SPROC    COglExtensions::glVertexAttrib3s = 0;
-PFNGLVERTEXATTRIB3SVPROC    COglExtensions::glVertexAttrib3sv = 0;
-PFNGLVERTEXATTRIB4BVPROC    COglExtensions::glVertexAttrib4bv = 0;
-PFNGLVERTEXATTRIB4DPROC    COglExtensions::glVertexAttrib4d = 0;
-PFNGLVERTEXATTRIB4DVPROC    COglExtensions::glVertexAttrib4dv = 0;
-PFNGLVERTEXATTRIB4FPROC    COglExtensions::glVertexAttrib4f = 0;
-PFNGLVERTEXATTRIB4FVPROC    COglExtensions::glVertexAttrib4fv = 0;
-PFNGLVERTEXATTRIB4IVPROC    COglExtensions::glVertexAttrib4iv = 0;
-PFNGLVERTEXATTRIB4NBVPROC    COglExtensions::glVertexAttrib4Nbv = 0;
-PFNGLVERTEXATTRIB4NIVPROC    COglExtensions::glVertexAttrib4Niv = 0;
-PFNGLVERTEXATTRIB4NSVPROC    COglExtensions::glVertexAttrib4Nsv = 0;
-PFNGLVERTEXATTRIB4NUBPROC    COglExtensions::glVertexAttrib4Nub = 0;
-PFNGLVERTEXATTRIB4NUBVPROC    COglExtensions::glVertexAttrib4Nubv = 0;
-PFNGLVERTEXATTRIB4NUIVPROC    COglExtensions::glVertexAttrib4Nuiv = 0;
-PFNGLVERTEXATTRIB4NUSVPROC    COglExtensions::glVertexAttrib4Nusv = 0;
-PFNGLVERTEXATTRIB4SPROC    COglExtensions::glVertexAttrib4s = 0;
-PFNGLVERTEXATTRIB4SVPROC    COglExtensions::glVertexAttrib4sv = 0;
-PFNGLVERTEXATTRIB4UBVPROC    COglExtensions::glVertexAttrib4ubv = 0;
-PFNGLVERTEXATTRIB4UIVPROC    COglExtensions::glVertexAttrib4uiv = 0;
-PFNGLVERTEXATTRIB4USVPROC    COglExtensions::glVertexAttrib4usv = 0;
-PFNGLVERTEXATTRIBBINDINGPROC    COglExtensions::glVertexAttribBinding = 0;
-PFNGLVERTEXATTRIBDIVISORPROC    COglExtensions::glVertexAttribDivisor = 0;
-PFNGLVERTEXATTRIBFORMATPROC    COglExtensions::glVertexAttribFormat = 0;
-PFNGLVERTEXATTRIBI1IPROC    COglExtensions::glVertexAttribI1i = 0;
-PFNGLVERTEXATTRIBI1IVPROC    COglExtensions::glVertexAttribI1iv = 0;
-PFNGLVERTEXATTRIBI1UIPROC    COglExtensions::glVertexAttribI1ui = 0;
-PFNGLVERTEXATTRIBI1UIVPROC    COglExtensions::glVertexAttribI1uiv = 0;
-PFNGLVERTEXATTRIBI2IPROC    COglExtensions::glVertexAttribI2i = 0;
-PFNGLVERTEXATTRIBI2IVPROC    COglExtensions::glVertexAttribI2iv = 0;
-PFNGLVERTEXATTRIBI2UIPROC    COglExtensions::glVertexAttribI2ui = 0;
-PFNGLVERTEXATTRIBI2UIVPROC    COglExtensions::glVertexAttribI2uiv = 0;
-PFNGLVERTEXATTRIBI3IPROC    COglExtensions::glVertexAttribI3i = 0;
-PFNGLVERTEXATTRIBI3IVPROC    COglExtensions::glVertexAttribI3iv = 0;
-PFNGLVERTEXATTRIBI3UIPROC    COglExtensions::glVertexAttribI3ui = 0;
-PFNGLVERTEXATTRIBI3UIVPROC    COglExtensions::glVertexAttribI3uiv = 0;
-PFNGLVERTEXATTRIBI4BVPROC    COglExtensions::glVertexAttribI4bv = 0;
-PFNGLVERTEXATTRIBI4IPROC    COglExtensions::glVertexAttribI4i = 0;
-PFNGLVERTEXATTRIBI4IVPROC    COglExtensions::glVertexAttribI4iv = 0;
-PFNGLVERTEXATTRIBI4SVPROC    COglExtensions::glVertexAttribI4sv = 0;
-PFNGLVERTEXATTRIBI4UBVPROC    COglExtensions::glVertexAttribI4ubv = 0;
-PFNGLVERTEXATTRIBI4UIPROC    COglExtensions::glVertexAttribI4ui = 0;
-PFNGLVERTEXATTRIBI4UIVPROC    COglExtensions::glVertexAttribI4uiv = 0;
-PFNGLVERTEXATTRIBI4USVPROC    COglExtensions::glVertexAttribI4usv = 0;
-PFNGLVERTEXATTRIBIFORMATPROC    COglExtensions::glVertexAttribIFormat = 0;
-PFNGLVERTEXATTRIBIPOINTERPROC    COglExtensions::glVertexAttribIPointer = 0;
-PFNGLVERTEXATTRIBL1DPROC    COglExtensions::glVertexAttribL1d = 0;
-PFNGLVERTEXATTRIBL1DVPROC    COglExtensions::glVertexAttribL1dv = 0;
-PFNGLVERTEXATTRIBL2DPROC    COglExtensions::glVertexAttribL2d = 0;
-PFNGLVERTEXATTRIBL2DVPROC    COglExtensions::glVertexAttribL2dv = 0;
-PFNGLVERTEXATTRIBL3DPROC    COglExtensions::glVertexAttribL3d = 0;
-PFNGLVERTEXATTRIBL3DVPROC    COglExtensions::glVertexAttribL3dv = 0;
-PFNGLVERTEXATTRIBL4DPROC    COglExtensions::glVertexAttribL4d = 0;
-PFNGLVERTEXATTRIBL4DVPROC    COglExtensions::glVertexAttribL4dv = 0;
-PFNGLVERTEXATTRIBLFORMATPROC    COglExtensions::glVertexAttribLFormat = 0;
-PFNGLVERTEXATTRIBLPOINTERPROC    COglExtensions::glVertexAttribLPointer = 0;
-PFNGLVERTEXATTRIBP1UIPROC    COglExtensions::glVertexAttribP1ui = 0;
-PFNGLVERTEXATTRIBP1UIVPROC    COglExtensions::glVertexAttribP1uiv = 0;
-PFNGLVERTEXATTRIBP2UIPROC    COglExtensions::glVertexAttribP2ui = 0;
-PFNGLVERTEXATTRIBP2UIVPROC    COglExtensions::glVertexAttribP2uiv = 0;
-PFNGLVERTEXATTRIBP3UIPROC    COglExtensions::glVertexAttribP3ui = 0;
-PFNGLVERTEXATTRIBP3UIVPROC    COglExtensions::glVertexAttribP3uiv = 0;
-PFNGLVERTEXATTRIBP4UIPROC    COglExtensions::glVertexAttribP4ui = 0;
-PFNGLVERTEXATTRIBP4UIVPROC    COglExtensions::glVertexAttribP4uiv = 0;
-PFNGLVERTEXATTRIBPOINTERPROC    COglExtensions::glVertexAttribPointer = 0;
-PFNGLVERTEXBINDINGDIVISORPROC    COglExtensions::glVertexBindingDivisor = 0;
-PFNGLVERTEXP2UIPROC    COglExtensions::glVertexP2ui = 0;
-PFNGLVERTEXP2UIVPROC    COglExtensions::glVertexP2uiv = 0;
-PFNGLVERTEXP3UIPROC    COglExtensions::glVertexP3ui = 0;
-PFNGLVERTEXP3UIVPROC    COglExtensions::glVertexP3uiv = 0;
-PFNGLVERTEXP4UIPROC    COglExtensions::glVertexP4ui = 0;
-PFNGLVERTEXP4UIVPROC    COglExtensions::glVertexP4uiv = 0;
-PFNGLVIEWPORTARRAYVPROC    COglExtensions::glViewportArrayv = 0;
-PFNGLVIEWPORTINDEXEDFPROC    COglExtensions::glViewportIndexedf = 0;
-PFNGLVIEWPORTINDEXEDFVPROC    COglExtensions::glViewportIndexedfv = 0;
-PFNGLWAITSYNCPROC    COglExtensions::glWaitSync = 0;
-PFNGLWINDOWPOS2DPROC    COglExtensions::glWindowPos2d = 0;
-PFNGLWINDOWPOS2DVPROC    COglExtensions::glWindowPos2dv = 0;
-PFNGLWINDOWPOS2FPROC    COglExtensions::glWindowPos2f = 0;
-PFNGLWINDOWPOS2FVPROC    COglExtensions::glWindowPos2fv = 0;
-PFNGLWINDOWPOS2IPROC    COglExtensions::glWindowPos2i = 0;
-PFNGLWINDOWPOS2IVPROC    COglExtensions::glWindowPos2iv = 0;
-PFNGLWINDOWPOS2SPROC    COglExtensions::glWindowPos2s = 0;
-PFNGLWINDOWPOS2SVPROC    COglExtensions::glWindowPos2sv = 0;
-PFNGLWINDOWPOS3DPROC    COglExtensions::glWindowPos3d = 0;
-PFNGLWINDOWPOS3DVPROC    COglExtensions::glWindowPos3dv = 0;
-PFNGLWINDOWPOS3FPROC    COglExtensions::glWindowPos3f = 0;
-PFNGLWINDOWPOS3FVPROC    COglExtensions::glWindowPos3fv = 0;
-PFNGLWINDOWPOS3IPROC    COglExtensions::glWindowPos3i = 0;
-PFNGLWINDOWPOS3IVPROC    COglExtensions::glWindowPos3iv = 0;
-PFNGLWINDOWPOS3SPROC    COglExtensions::glWindowPos3s = 0;
-PFNGLWINDOWPOS3SVPROC    COglExtensions::glWindowPos3sv = 0;
+PFNGLACTIVESHADERPROGRAMPROC    Extensions::glActiveShaderProgram = 0;
+PFNGLACTIVETEXTUREPROC    Extensions::glActiveTexture = 0;
+PFNGLATTACHOBJECTARBPROC    Extensions::glAttachObjectARB = 0;
+PFNGLATTACHSHADERPROC    Extensions::glAttachShader = 0;
+PFNGLBEGINCONDITIONALRENDERPROC    Extensions::glBeginConditionalRender = 0;
+PFNGLBEGINQUERYPROC    Extensions::glBeginQuery = 0;
+PFNGLBEGINQUERYINDEXEDPROC    Extensions::glBeginQueryIndexed = 0;
+PFNGLBEGINTRANSFORMFEEDBACKPROC    Extensions::glBeginTransformFeedback = 0;
+PFNGLBINDATTRIBLOCATIONPROC    Extensions::glBindAttribLocation = 0;
+PFNGLBINDBUFFERPROC    Extensions::glBindBuffer = 0;
+PFNGLBINDBUFFERBASEPROC    Extensions::glBindBufferBase = 0;
+PFNGLBINDBUFFERRANGEPROC    Extensions::glBindBufferRange = 0;
+PFNGLBINDBUFFERSBASEPROC    Extensions::glBindBuffersBase = 0;
+PFNGLBINDBUFFERSRANGEPROC    Extensions::glBindBuffersRange = 0;
+PFNGLBINDFRAGDATALOCATIONPROC    Extensions::glBindFragDataLocation = 0;
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC    Extensions::glBindFragDataLocationIndexed = 0;
+PFNGLBINDFRAMEBUFFERPROC    Extensions::glBindFramebuffer = 0;
+PFNGLBINDIMAGETEXTUREPROC    Extensions::glBindImageTexture = 0;
+PFNGLBINDIMAGETEXTURESPROC    Extensions::glBindImageTextures = 0;
+PFNGLBINDPROGRAMPIPELINEPROC    Extensions::glBindProgramPipeline = 0;
+PFNGLBINDRENDERBUFFERPROC    Extensions::glBindRenderbuffer = 0;
+PFNGLBINDSAMPLERPROC    Extensions::glBindSampler = 0;
+PFNGLBINDSAMPLERSPROC    Extensions::glBindSamplers = 0;
+PFNGLBINDTEXTURESPROC    Extensions::glBindTextures = 0;
+PFNGLBINDTEXTUREUNITPROC    Extensions::glBindTextureUnit = 0;
+PFNGLBINDTRANSFORMFEEDBACKPROC    Extensions::glBindTransformFeedback = 0;
+PFNGLBINDVERTEXARRAYPROC    Extensions::glBindVertexArray = 0;
+PFNGLBINDVERTEXBUFFERPROC    Extensions::glBindVertexBuffer = 0;
+PFNGLBINDVERTEXBUFFERSPROC    Extensions::glBindVertexBuffers = 0;
+PFNGLBLENDCOLORPROC    Extensions::glBlendColor = 0;
+PFNGLBLENDEQUATIONPROC    Extensions::glBlendEquation = 0;
+PFNGLBLENDEQUATIONIPROC    Extensions::glBlendEquationi = 0;
+PFNGLBLENDEQUATIONSEPARATEPROC    Extensions::glBlendEquationSeparate = 0;
+PFNGLBLENDEQUATIONSEPARATEIPROC    Extensions::glBlendEquationSeparatei = 0;
+PFNGLBLENDFUNCIPROC    Extensions::glBlendFunci = 0;
+PFNGLBLENDFUNCSEPARATEPROC    Extensions::glBlendFuncSeparate = 0;
+PFNGLBLENDFUNCSEPARATEIPROC    Extensions::glBlendFuncSeparatei = 0;
+PFNGLBLITFRAMEBUFFERPROC    Extensions::glBlitFramebuffer = 0;
+PFNGLBLITNAMEDFRAMEBUFFERPROC    Extensions::glBlitNamedFramebuffer = 0;
+PFNGLBUFFERDATAPROC    Extensions::glBufferData = 0;
+PFNGLBUFFERSTORAGEPROC    Extensions::glBufferStorage = 0;
+PFNGLBUFFERSUBDATAPROC    Extensions::glBufferSubData = 0;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC    Extensions::glCheckFramebufferStatus = 0;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC    Extensions::glCheckNamedFramebufferStatus = 0;
+PFNGLCLAMPCOLORPROC    Extensions::glClampColor = 0;
+PFNGLCLEARBUFFERDATAPROC    Extensions::glClearBufferData = 0;
+PFNGLCLEARBUFFERFIPROC    Extensions::glClearBufferfi = 0;
+PFNGLCLEARBUFFERFVPROC    Extensions::glClearBufferfv = 0;
+PFNGLCLEARBUFFERIVPROC    Extensions::glClearBufferiv = 0;
+PFNGLCLEARBUFFERSUBDATAPROC    Extensions::glClearBufferSubData = 0;
+PFNGLCLEARBUFFERUIVPROC    Extensions::glClearBufferuiv = 0;
+PFNGLCLEARDEPTHFPROC    Extensions::glClearDepthf = 0;
+PFNGLCLEARNAMEDBUFFERDATAPROC    Extensions::glClearNamedBufferData = 0;
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC    Extensions::glClearNamedBufferSubData = 0;
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC    Extensions::glClearNamedFramebufferfi = 0;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC    Extensions::glClearNamedFramebufferfv = 0;
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC    Extensions::glClearNamedFramebufferiv = 0;
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC    Extensions::glClearNamedFramebufferuiv = 0;
+PFNGLCLEARTEXIMAGEPROC    Extensions::glClearTexImage = 0;
+PFNGLCLEARTEXSUBIMAGEPROC    Extensions::glClearTexSubImage = 0;
+PFNGLCLIENTACTIVETEXTUREPROC    Extensions::glClientActiveTexture = 0;
+PFNGLCLIENTWAITSYNCPROC    Extensions::glClientWaitSync = 0;
+PFNGLCLIPCONTROLPROC    Extensions::glClipControl = 0;
+PFNGLCOLORMASKIPROC    Extensions::glColorMaski = 0;
+PFNGLCOLORP3UIPROC    Extensions::glColorP3ui = 0;
+PFNGLCOLORP3UIVPROC    Extensions::glColorP3uiv = 0;
+PFNGLCOLORP4UIPROC    Extensions::glColorP4ui = 0;
+PFNGLCOLORP4UIVPROC    Extensions::glColorP4uiv = 0;
+PFNGLCOMPILESHADERPROC    Extensions::glCompileShader = 0;
+PFNGLCOMPILESHADERARBPROC    Extensions::glCompileShaderARB = 0;
+PFNGLCOMPRESSEDTEXIMAGE1DPROC    Extensions::glCompressedTexImage1D = 0;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC    Extensions::glCompressedTexImage2D = 0;
+PFNGLCOMPRESSEDTEXIMAGE3DPROC    Extensions::glCompressedTexImage3D = 0;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC    Extensions::glCompressedTexSubImage1D = 0;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC    Extensions::glCompressedTexSubImage2D = 0;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC    Extensions::glCompressedTexSubImage3D = 0;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC    Extensions::glCompressedTextureSubImage1D = 0;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC    Extensions::glCompressedTextureSubImage2D = 0;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC    Extensions::glCompressedTextureSubImage3D = 0;
+PFNGLCOPYBUFFERSUBDATAPROC    Extensions::glCopyBufferSubData = 0;
+PFNGLCOPYIMAGESUBDATAPROC    Extensions::glCopyImageSubData = 0;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC    Extensions::glCopyNamedBufferSubData = 0;
+PFNGLCOPYTEXSUBIMAGE3DPROC    Extensions::glCopyTexSubImage3D = 0;
+PFNGLCOPYTEXTURESUBIMAGE1DPROC    Extensions::glCopyTextureSubImage1D = 0;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC    Extensions::glCopyTextureSubImage2D = 0;
+PFNGLCOPYTEXTURESUBIMAGE3DPROC    Extensions::glCopyTextureSubImage3D = 0;
+PFNGLCREATEBUFFERSPROC    Extensions::glCreateBuffers = 0;
+PFNGLCREATEFRAMEBUFFERSPROC    Extensions::glCreateFramebuffers = 0;
+PFNGLCREATEPROGRAMPROC    Extensions::glCreateProgram = 0;
+PFNGLCREATEPROGRAMOBJECTARBPROC    Extensions::glCreateProgramObjectARB = 0;
+PFNGLCREATEPROGRAMPIPELINESPROC    Extensions::glCreateProgramPipelines = 0;
+PFNGLCREATEQUERIESPROC    Extensions::glCreateQueries = 0;
+PFNGLCREATERENDERBUFFERSPROC    Extensions::glCreateRenderbuffers = 0;
+PFNGLCREATESAMPLERSPROC    Extensions::glCreateSamplers = 0;
+PFNGLCREATESHADERPROC    Extensions::glCreateShader = 0;
+PFNGLCREATESHADEROBJECTARBPROC    Extensions::glCreateShaderObjectARB = 0;
+PFNGLCREATESHADERPROGRAMVPROC    Extensions::glCreateShaderProgramv = 0;
+PFNGLCREATETEXTURESPROC    Extensions::glCreateTextures = 0;
+PFNGLCREATETRANSFORMFEEDBACKSPROC    Extensions::glCreateTransformFeedbacks = 0;
+PFNGLCREATEVERTEXARRAYSPROC    Extensions::glCreateVertexArrays = 0;
+PFNGLDEBUGMESSAGECALLBACKPROC    Extensions::glDebugMessageCallback = 0;
+PFNGLDEBUGMESSAGECONTROLPROC    Extensions::glDebugMessageControl = 0;
+PFNGLDEBUGMESSAGEINSERTPROC    Extensions::glDebugMessageInsert = 0;
+PFNGLDELETEBUFFERSPROC    Extensions::glDeleteBuffers = 0;
+PFNGLDELETEFRAMEBUFFERSPROC    Extensions::glDeleteFramebuffers = 0;
+PFNGLDELETEOBJECTARBPROC    Extensions::glDeleteObjectARB = 0;
+PFNGLDELETEPROGRAMPROC    Extensions::glDeleteProgram = 0;
+PFNGLDELETEPROGRAMPIPELINESPROC    Extensions::glDeleteProgramPipelines = 0;
+PFNGLDELETEQUERIESPROC    Extensions::glDeleteQueries = 0;
+PFNGLDELETERENDERBUFFERSPROC    Extensions::glDeleteRenderbuffers = 0;
+PFNGLDELETESAMPLERSPROC    Extensions::glDeleteSamplers = 0;
+PFNGLDELETESHADERPROC    Extensions::glDeleteShader = 0;
+PFNGLDELETESYNCPROC    Extensions::glDeleteSync = 0;
+PFNGLDELETETRANSFORMFEEDBACKSPROC    Extensions::glDeleteTransformFeedbacks = 0;
+PFNGLDELETEVERTEXARRAYSPROC    Extensions::glDeleteVertexArrays = 0;
+PFNGLDEPTHRANGEARRAYVPROC    Extensions::glDepthRangeArrayv = 0;
+PFNGLDEPTHRANGEFPROC    Extensions::glDepthRangef = 0;
+PFNGLDEPTHRANGEINDEXEDPROC    Extensions::glDepthRangeIndexed = 0;
+PFNGLDETACHOBJECTARBPROC    Extensions::glDetachObjectARB = 0;
+PFNGLDETACHSHADERPROC    Extensions::glDetachShader = 0;
+PFNGLDISABLEIPROC    Extensions::glDisablei = 0;
+PFNGLDISABLEVERTEXARRAYATTRIBPROC    Extensions::glDisableVertexArrayAttrib = 0;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC    Extensions::glDisableVertexAttribArray = 0;
+PFNGLDISPATCHCOMPUTEPROC    Extensions::glDispatchCompute = 0;
+PFNGLDISPATCHCOMPUTEINDIRECTPROC    Extensions::glDispatchComputeIndirect = 0;
+PFNGLDRAWARRAYSINDIRECTPROC    Extensions::glDrawArraysIndirect = 0;
+PFNGLDRAWARRAYSINSTANCEDPROC    Extensions::glDrawArraysInstanced = 0;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC    Extensions::glDrawArraysInstancedBaseInstance = 0;
+PFNGLDRAWBUFFERSPROC    Extensions::glDrawBuffers = 0;
+PFNGLDRAWELEMENTSBASEVERTEXPROC    Extensions::glDrawElementsBaseVertex = 0;
+PFNGLDRAWELEMENTSINDIRECTPROC    Extensions::glDrawElementsIndirect = 0;
+PFNGLDRAWELEMENTSINSTANCEDPROC    Extensions::glDrawElementsInstanced = 0;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC    Extensions::glDrawElementsInstancedBaseInstance = 0;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC    Extensions::glDrawElementsInstancedBaseVertex = 0;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC    Extensions::glDrawElementsInstancedBaseVertexBaseInstance = 0;
+PFNGLDRAWRANGEELEMENTSPROC    Extensions::glDrawRangeElements = 0;
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC    Extensions::glDrawRangeElementsBaseVertex = 0;
+PFNGLDRAWTRANSFORMFEEDBACKPROC    Extensions::glDrawTransformFeedback = 0;
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC    Extensions::glDrawTransformFeedbackInstanced = 0;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC    Extensions::glDrawTransformFeedbackStream = 0;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC    Extensions::glDrawTransformFeedbackStreamInstanced = 0;
+PFNGLENABLEIPROC    Extensions::glEnablei = 0;
+PFNGLENABLEVERTEXARRAYATTRIBPROC    Extensions::glEnableVertexArrayAttrib = 0;
+PFNGLENABLEVERTEXATTRIBARRAYPROC    Extensions::glEnableVertexAttribArray = 0;
+PFNGLENDCONDITIONALRENDERPROC    Extensions::glEndConditionalRender = 0;
+PFNGLENDQUERYPROC    Extensions::glEndQuery = 0;
+PFNGLENDQUERYINDEXEDPROC    Extensions::glEndQueryIndexed = 0;
+PFNGLENDTRANSFORMFEEDBACKPROC    Extensions::glEndTransformFeedback = 0;
+PFNGLFENCESYNCPROC    Extensions::glFenceSync = 0;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC    Extensions::glFlushMappedBufferRange = 0;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC    Extensions::glFlushMappedNamedBufferRange = 0;
+PFNGLFOGCOORDDPROC    Extensions::glFogCoordd = 0;
+PFNGLFOGCOORDDVPROC    Extensions::glFogCoorddv = 0;
+PFNGLFOGCOORDFPROC    Extensions::glFogCoordf = 0;
+PFNGLFOGCOORDFVPROC    Extensions::glFogCoordfv = 0;
+PFNGLFOGCOORDPOINTERPROC    Extensions::glFogCoordPointer = 0;
+PFNGLFRAMEBUFFERPARAMETERIPROC    Extensions::glFramebufferParameteri = 0;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC    Extensions::glFramebufferRenderbuffer = 0;
+PFNGLFRAMEBUFFERTEXTUREPROC    Extensions::glFramebufferTexture = 0;
+PFNGLFRAMEBUFFERTEXTURE1DPROC    Extensions::glFramebufferTexture1D = 0;
+PFNGLFRAMEBUFFERTEXTURE2DPROC    Extensions::glFramebufferTexture2D = 0;
+PFNGLFRAMEBUFFERTEXTURE3DPROC    Extensions::glFramebufferTexture3D = 0;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC    Extensions::glFramebufferTextureLayer = 0;
+PFNGLGENBUFFERSPROC    Extensions::glGenBuffers = 0;
+PFNGLGENERATEMIPMAPPROC    Extensions::glGenerateMipmap = 0;
+PFNGLGENERATETEXTUREMIPMAPPROC    Extensions::glGenerateTextureMipmap = 0;
+PFNGLGENFRAMEBUFFERSPROC    Extensions::glGenFramebuffers = 0;
+PFNGLGENPROGRAMPIPELINESPROC    Extensions::glGenProgramPipelines = 0;
+PFNGLGENQUERIESPROC    Extensions::glGenQueries = 0;
+PFNGLGENRENDERBUFFERSPROC    Extensions::glGenRenderbuffers = 0;
+PFNGLGENSAMPLERSPROC    Extensions::glGenSamplers = 0;
+PFNGLGENTRANSFORMFEEDBACKSPROC    Extensions::glGenTransformFeedbacks = 0;
+PFNGLGENVERTEXARRAYSPROC    Extensions::glGenVertexArrays = 0;
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC    Extensions::glGetActiveAtomicCounterBufferiv = 0;
+PFNGLGETACTIVEATTRIBPROC    Extensions::glGetActiveAttrib = 0;
+PFNGLGETACTIVESUBROUTINENAMEPROC    Extensions::glGetActiveSubroutineName = 0;
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC    Extensions::glGetActiveSubroutineUniformiv = 0;
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC    Extensions::glGetActiveSubroutineUniformName = 0;
+PFNGLGETACTIVEUNIFORMPROC    Extensions::glGetActiveUniform = 0;
+PFNGLGETACTIVEUNIFORMARBPROC    Extensions::glGetActiveUniformARB = 0;
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC    Extensions::glGetActiveUniformBlockiv = 0;
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC    Extensions::glGetActiveUniformBlockName = 0;
+PFNGLGETACTIVEUNIFORMNAMEPROC    Extensions::glGetActiveUniformName = 0;
+PFNGLGETACTIVEUNIFORMSIVPROC    Extensions::glGetActiveUniformsiv = 0;
+PFNGLGETATTACHEDOBJECTSARBPROC    Extensions::glGetAttachedObjectsARB = 0;
+PFNGLGETATTACHEDSHADERSPROC    Extensions::glGetAttachedShaders = 0;
+PFNGLGETATTRIBLOCATIONPROC    Extensions::glGetAttribLocation = 0;
+PFNGLGETBOOLEANI_VPROC    Extensions::glGetBooleani_v = 0;
+PFNGLGETBUFFERPARAMETERI64VPROC    Extensions::glGetBufferParameteri64v = 0;
+PFNGLGETBUFFERPARAMETERIVPROC    Extensions::glGetBufferParameteriv = 0;
+PFNGLGETBUFFERPOINTERVPROC    Extensions::glGetBufferPointerv = 0;
+PFNGLGETBUFFERSUBDATAPROC    Extensions::glGetBufferSubData = 0;
+PFNGLGETCOMPRESSEDTEXIMAGEPROC    Extensions::glGetCompressedTexImage = 0;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC    Extensions::glGetCompressedTextureImage = 0;
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC    Extensions::glGetCompressedTextureSubImage = 0;
+PFNGLGETDEBUGMESSAGELOGPROC    Extensions::glGetDebugMessageLog = 0;
+PFNGLGETDOUBLEI_VPROC    Extensions::glGetDoublei_v = 0;
+PFNGLGETFLOATI_VPROC    Extensions::glGetFloati_v = 0;
+PFNGLGETFRAGDATAINDEXPROC    Extensions::glGetFragDataIndex = 0;
+PFNGLGETFRAGDATALOCATIONPROC    Extensions::glGetFragDataLocation = 0;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC    Extensions::glGetFramebufferAttachmentParameteriv = 0;
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC    Extensions::glGetFramebufferParameteriv = 0;
+PFNGLGETGRAPHICSRESETSTATUSPROC    Extensions::glGetGraphicsResetStatus = 0;
+PFNGLGETHANDLEARBPROC    Extensions::glGetHandleARB = 0;
+PFNGLGETINFOLOGARBPROC    Extensions::glGetInfoLogARB = 0;
+PFNGLGETINTEGER64I_VPROC    Extensions::glGetInteger64i_v = 0;
+PFNGLGETINTEGER64VPROC    Extensions::glGetInteger64v = 0;
+PFNGLGETINTEGERI_VPROC    Extensions::glGetIntegeri_v = 0;
+PFNGLGETINTERNALFORMATI64VPROC    Extensions::glGetInternalformati64v = 0;
+PFNGLGETINTERNALFORMATIVPROC    Extensions::glGetInternalformativ = 0;
+PFNGLGETMULTISAMPLEFVPROC    Extensions::glGetMultisamplefv = 0;
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC    Extensions::glGetNamedBufferParameteri64v = 0;
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC    Extensions::glGetNamedBufferParameteriv = 0;
+PFNGLGETNAMEDBUFFERPOINTERVPROC    Extensions::glGetNamedBufferPointerv = 0;
+PFNGLGETNAMEDBUFFERSUBDATAPROC    Extensions::glGetNamedBufferSubData = 0;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC    Extensions::glGetNamedFramebufferAttachmentParameteriv = 0;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC    Extensions::glGetNamedFramebufferParameteriv = 0;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC    Extensions::glGetNamedRenderbufferParameteriv = 0;
+//PFNGLGETNCOLORTABLEPROC    Extensions::glGetnColorTable = 0;
+PFNGLGETNCOMPRESSEDTEXIMAGEPROC    Extensions::glGetnCompressedTexImage = 0;
+//PFNGLGETNCONVOLUTIONFILTERPROC    Extensions::glGetnConvolutionFilter = 0;
+//PFNGLGETNHISTOGRAMPROC    Extensions::glGetnHistogram = 0;
+//PFNGLGETNMAPDVPROC    Extensions::glGetnMapdv = 0;
+//PFNGLGETNMAPFVPROC    Extensions::glGetnMapfv = 0;
+//PFNGLGETNMAPIVPROC    Extensions::glGetnMapiv = 0;
+//PFNGLGETNMINMAXPROC    Extensions::glGetnMinmax = 0;
+//PFNGLGETNPIXELMAPFVPROC    Extensions::glGetnPixelMapfv = 0;
+//PFNGLGETNPIXELMAPUIVPROC    Extensions::glGetnPixelMapuiv = 0;
+//PFNGLGETNPIXELMAPUSVPROC    Extensions::glGetnPixelMapusv = 0;
+PFNGLGETNPOLYGONSTIPPLEPROC    Extensions::glGetnPolygonStipple = 0;
+PFNGLGETNSEPARABLEFILTERPROC    Extensions::glGetnSeparableFilter = 0;
+PFNGLGETNTEXIMAGEPROC    Extensions::glGetnTexImage = 0;
+PFNGLGETNUNIFORMDVPROC    Extensions::glGetnUniformdv = 0;
+PFNGLGETNUNIFORMFVPROC    Extensions::glGetnUniformfv = 0;
+PFNGLGETNUNIFORMIVPROC    Extensions::glGetnUniformiv = 0;
+PFNGLGETNUNIFORMUIVPROC    Extensions::glGetnUniformuiv = 0;
+PFNGLGETOBJECTLABELPROC    Extensions::glGetObjectLabel = 0;
+PFNGLGETOBJECTPARAMETERFVARBPROC    Extensions::glGetObjectParameterfvARB = 0;
+PFNGLGETOBJECTPARAMETERIVARBPROC    Extensions::glGetObjectParameterivARB = 0;
+PFNGLGETOBJECTPTRLABELPROC    Extensions::glGetObjectPtrLabel = 0;
+PFNGLGETPROGRAMBINARYPROC    Extensions::glGetProgramBinary = 0;
+PFNGLGETPROGRAMINFOLOGPROC    Extensions::glGetProgramInfoLog = 0;
+PFNGLGETPROGRAMINTERFACEIVPROC    Extensions::glGetProgramInterfaceiv = 0;
+PFNGLGETPROGRAMIVPROC    Extensions::glGetProgramiv = 0;
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC    Extensions::glGetProgramPipelineInfoLog = 0;
+PFNGLGETPROGRAMPIPELINEIVPROC    Extensions::glGetProgramPipelineiv = 0;
+PFNGLGETPROGRAMRESOURCEINDEXPROC    Extensions::glGetProgramResourceIndex = 0;
+PFNGLGETPROGRAMRESOURCEIVPROC    Extensions::glGetProgramResourceiv = 0;
+PFNGLGETPROGRAMRESOURCELOCATIONPROC    Extensions::glGetProgramResourceLocation = 0;
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC    Extensions::glGetProgramResourceLocationIndex = 0;
+PFNGLGETPROGRAMRESOURCENAMEPROC    Extensions::glGetProgramResourceName = 0;
+PFNGLGETPROGRAMSTAGEIVPROC    Extensions::glGetProgramStageiv = 0;
+PFNGLGETQUERYBUFFEROBJECTI64VPROC    Extensions::glGetQueryBufferObjecti64v = 0;
+PFNGLGETQUERYBUFFEROBJECTIVPROC    Extensions::glGetQueryBufferObjectiv = 0;
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC    Extensions::glGetQueryBufferObjectui64v = 0;
+PFNGLGETQUERYBUFFEROBJECTUIVPROC    Extensions::glGetQueryBufferObjectuiv = 0;
+PFNGLGETQUERYINDEXEDIVPROC    Extensions::glGetQueryIndexediv = 0;
+PFNGLGETQUERYIVPROC    Extensions::glGetQueryiv = 0;
+PFNGLGETQUERYOBJECTI64VPROC    Extensions::glGetQueryObjecti64v = 0;
+PFNGLGETQUERYOBJECTIVPROC    Extensions::glGetQueryObjectiv = 0;
+PFNGLGETQUERYOBJECTUI64VPROC    Extensions::glGetQueryObjectui64v = 0;
+PFNGLGETQUERYOBJECTUIVPROC    Extensions::glGetQueryObjectuiv = 0;
+PFNGLGETRENDERBUFFERPARAMETERIVPROC    Extensions::glGetRenderbufferParameteriv = 0;
+PFNGLGETSAMPLERPARAMETERFVPROC    Extensions::glGetSamplerParameterfv = 0;
+PFNGLGETSAMPLERPARAMETERIIVPROC    Extensions::glGetSamplerParameterIiv = 0;
+PFNGLGETSAMPLERPARAMETERIUIVPROC    Extensions::glGetSamplerParameterIuiv = 0;
+PFNGLGETSAMPLERPARAMETERIVPROC    Extensions::glGetSamplerParameteriv = 0;
+PFNGLGETSHADERINFOLOGPROC    Extensions::glGetShaderInfoLog = 0;
+PFNGLGETSHADERIVPROC    Extensions::glGetShaderiv = 0;
+PFNGLGETSHADERPRECISIONFORMATPROC    Extensions::glGetShaderPrecisionFormat = 0;
+PFNGLGETSHADERSOURCEPROC    Extensions::glGetShaderSource = 0;
+PFNGLGETSHADERSOURCEARBPROC    Extensions::glGetShaderSourceARB = 0;
+PFNGLGETSTRINGIPROC    Extensions::glGetStringi = 0;
+PFNGLGETSUBROUTINEINDEXPROC    Extensions::glGetSubroutineIndex = 0;
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC    Extensions::glGetSubroutineUniformLocation = 0;
+PFNGLGETSYNCIVPROC    Extensions::glGetSynciv = 0;
+PFNGLGETTEXPARAMETERIIVPROC    Extensions::glGetTexParameterIiv = 0;
+PFNGLGETTEXPARAMETERIUIVPROC    Extensions::glGetTexParameterIuiv = 0;
+PFNGLGETTEXTUREIMAGEPROC    Extensions::glGetTextureImage = 0;
+PFNGLGETTEXTURELEVELPARAMETERFVPROC    Extensions::glGetTextureLevelParameterfv = 0;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC    Extensions::glGetTextureLevelParameteriv = 0;
+PFNGLGETTEXTUREPARAMETERFVPROC    Extensions::glGetTextureParameterfv = 0;
+PFNGLGETTEXTUREPARAMETERIIVPROC    Extensions::glGetTextureParameterIiv = 0;
+PFNGLGETTEXTUREPARAMETERIUIVPROC    Extensions::glGetTextureParameterIuiv = 0;
+PFNGLGETTEXTUREPARAMETERIVPROC    Extensions::glGetTextureParameteriv = 0;
+PFNGLGETTEXTURESUBIMAGEPROC    Extensions::glGetTextureSubImage = 0;
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC    Extensions::glGetTransformFeedbacki64_v = 0;
+PFNGLGETTRANSFORMFEEDBACKI_VPROC    Extensions::glGetTransformFeedbacki_v = 0;
+PFNGLGETTRANSFORMFEEDBACKIVPROC    Extensions::glGetTransformFeedbackiv = 0;
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC    Extensions::glGetTransformFeedbackVarying = 0;
+PFNGLGETUNIFORMBLOCKINDEXPROC    Extensions::glGetUniformBlockIndex = 0;
+PFNGLGETUNIFORMDVPROC    Extensions::glGetUniformdv = 0;
+PFNGLGETUNIFORMFVPROC    Extensions::glGetUniformfv = 0;
+PFNGLGETUNIFORMFVARBPROC    Extensions::glGetUniformfvARB = 0;
+PFNGLGETUNIFORMINDICESPROC    Extensions::glGetUniformIndices = 0;
+PFNGLGETUNIFORMIVPROC    Extensions::glGetUniformiv = 0;
+PFNGLGETUNIFORMIVARBPROC    Extensions::glGetUniformivARB = 0;
+PFNGLGETUNIFORMLOCATIONPROC    Extensions::glGetUniformLocation = 0;
+PFNGLGETUNIFORMLOCATIONARBPROC    Extensions::glGetUniformLocationARB = 0;
+PFNGLGETUNIFORMSUBROUTINEUIVPROC    Extensions::glGetUniformSubroutineuiv = 0;
+PFNGLGETUNIFORMUIVPROC    Extensions::glGetUniformuiv = 0;
+PFNGLGETVERTEXARRAYINDEXED64IVPROC    Extensions::glGetVertexArrayIndexed64iv = 0;
+PFNGLGETVERTEXARRAYINDEXEDIVPROC    Extensions::glGetVertexArrayIndexediv = 0;
+PFNGLGETVERTEXARRAYIVPROC    Extensions::glGetVertexArrayiv = 0;
+PFNGLGETVERTEXATTRIBDVPROC    Extensions::glGetVertexAttribdv = 0;
+PFNGLGETVERTEXATTRIBFVPROC    Extensions::glGetVertexAttribfv = 0;
+PFNGLGETVERTEXATTRIBIIVPROC    Extensions::glGetVertexAttribIiv = 0;
+PFNGLGETVERTEXATTRIBIUIVPROC    Extensions::glGetVertexAttribIuiv = 0;
+PFNGLGETVERTEXATTRIBIVPROC    Extensions::glGetVertexAttribiv = 0;
+PFNGLGETVERTEXATTRIBLDVPROC    Extensions::glGetVertexAttribLdv = 0;
+PFNGLGETVERTEXATTRIBPOINTERVPROC    Extensions::glGetVertexAttribPointerv = 0;
+PFNGLINVALIDATEBUFFERDATAPROC    Extensions::glInvalidateBufferData = 0;
+PFNGLINVALIDATEBUFFERSUBDATAPROC    Extensions::glInvalidateBufferSubData = 0;
+PFNGLINVALIDATEFRAMEBUFFERPROC    Extensions::glInvalidateFramebuffer = 0;
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC    Extensions::glInvalidateNamedFramebufferData = 0;
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC    Extensions::glInvalidateNamedFramebufferSubData = 0;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC    Extensions::glInvalidateSubFramebuffer = 0;
+PFNGLINVALIDATETEXIMAGEPROC    Extensions::glInvalidateTexImage = 0;
+PFNGLINVALIDATETEXSUBIMAGEPROC    Extensions::glInvalidateTexSubImage = 0;
+PFNGLISBUFFERPROC    Extensions::glIsBuffer = 0;
+PFNGLISENABLEDIPROC    Extensions::glIsEnabledi = 0;
+PFNGLISFRAMEBUFFERPROC    Extensions::glIsFramebuffer = 0;
+PFNGLISPROGRAMPROC    Extensions::glIsProgram = 0;
+PFNGLISPROGRAMPIPELINEPROC    Extensions::glIsProgramPipeline = 0;
+PFNGLISQUERYPROC    Extensions::glIsQuery = 0;
+PFNGLISRENDERBUFFERPROC    Extensions::glIsRenderbuffer = 0;
+PFNGLISSAMPLERPROC    Extensions::glIsSampler = 0;
+PFNGLISSHADERPROC    Extensions::glIsShader = 0;
+PFNGLISSYNCPROC    Extensions::glIsSync = 0;
+PFNGLISTRANSFORMFEEDBACKPROC    Extensions::glIsTransformFeedback = 0;
+PFNGLISVERTEXARRAYPROC    Extensions::glIsVertexArray = 0;
+PFNGLLINKPROGRAMPROC    Extensions::glLinkProgram = 0;
+PFNGLLINKPROGRAMARBPROC    Extensions::glLinkProgramARB = 0;
+PFNGLLOADTRANSPOSEMATRIXDPROC    Extensions::glLoadTransposeMatrixd = 0;
+PFNGLLOADTRANSPOSEMATRIXFPROC    Extensions::glLoadTransposeMatrixf = 0;
+PFNGLMAPBUFFERPROC    Extensions::glMapBuffer = 0;
+PFNGLMAPBUFFERRANGEPROC    Extensions::glMapBufferRange = 0;
+PFNGLMAPNAMEDBUFFERPROC    Extensions::glMapNamedBuffer = 0;
+PFNGLMAPNAMEDBUFFERRANGEPROC    Extensions::glMapNamedBufferRange = 0;
+PFNGLMEMORYBARRIERPROC    Extensions::glMemoryBarrier = 0;
+PFNGLMEMORYBARRIERBYREGIONPROC    Extensions::glMemoryBarrierByRegion = 0;
+PFNGLMINSAMPLESHADINGPROC    Extensions::glMinSampleShading = 0;
+PFNGLMULTIDRAWARRAYSPROC    Extensions::glMultiDrawArrays = 0;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC    Extensions::glMultiDrawArraysIndirect = 0;
+//PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC    Extensions::glMultiDrawArraysIndirectCount = 0;
+PFNGLMULTIDRAWELEMENTSPROC    Extensions::glMultiDrawElements = 0;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC    Extensions::glMultiDrawElementsBaseVertex = 0;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC    Extensions::glMultiDrawElementsIndirect = 0;
+//PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC    Extensions::glMultiDrawElementsIndirectCount = 0;
+PFNGLMULTITEXCOORD1DPROC    Extensions::glMultiTexCoord1d = 0;
+PFNGLMULTITEXCOORD1DVPROC    Extensions::glMultiTexCoord1dv = 0;
+PFNGLMULTITEXCOORD1FPROC    Extensions::glMultiTexCoord1f = 0;
+PFNGLMULTITEXCOORD1FVPROC    Extensions::glMultiTexCoord1fv = 0;
+PFNGLMULTITEXCOORD1IPROC    Extensions::glMultiTexCoord1i = 0;
+PFNGLMULTITEXCOORD1IVPROC    Extensions::glMultiTexCoord1iv = 0;
+PFNGLMULTITEXCOORD1SPROC    Extensions::glMultiTexCoord1s = 0;
+PFNGLMULTITEXCOORD1SVPROC    Extensions::glMultiTexCoord1sv = 0;
+PFNGLMULTITEXCOORD2DPROC    Extensions::glMultiTexCoord2d = 0;
+PFNGLMULTITEXCOORD2DVPROC    Extensions::glMultiTexCoord2dv = 0;
+PFNGLMULTITEXCOORD2FPROC    Extensions::glMultiTexCoord2f = 0;
+PFNGLMULTITEXCOORD2FVPROC    Extensions::glMultiTexCoord2fv = 0;
+PFNGLMULTITEXCOORD2IPROC    Extensions::glMultiTexCoord2i = 0;
+PFNGLMULTITEXCOORD2IVPROC    Extensions::glMultiTexCoord2iv = 0;
+PFNGLMULTITEXCOORD2SPROC    Extensions::glMultiTexCoord2s = 0;
+PFNGLMULTITEXCOORD2SVPROC    Extensions::glMultiTexCoord2sv = 0;
+PFNGLMULTITEXCOORD3DPROC    Extensions::glMultiTexCoord3d = 0;
+PFNGLMULTITEXCOORD3DVPROC    Extensions::glMultiTexCoord3dv = 0;
+PFNGLMULTITEXCOORD3FPROC    Extensions::glMultiTexCoord3f = 0;
+PFNGLMULTITEXCOORD3FVPROC    Extensions::glMultiTexCoord3fv = 0;
+PFNGLMULTITEXCOORD3IPROC    Extensions::glMultiTexCoord3i = 0;
+PFNGLMULTITEXCOORD3IVPROC    Extensions::glMultiTexCoord3iv = 0;
+PFNGLMULTITEXCOORD3SPROC    Extensions::glMultiTexCoord3s = 0;
+PFNGLMULTITEXCOORD3SVPROC    Extensions::glMultiTexCoord3sv = 0;
+PFNGLMULTITEXCOORD4DPROC    Extensions::glMultiTexCoord4d = 0;
+PFNGLMULTITEXCOORD4DVPROC    Extensions::glMultiTexCoord4dv = 0;
+PFNGLMULTITEXCOORD4FPROC    Extensions::glMultiTexCoord4f = 0;
+PFNGLMULTITEXCOORD4FVPROC    Extensions::glMultiTexCoord4fv = 0;
+PFNGLMULTITEXCOORD4IPROC    Extensions::glMultiTexCoord4i = 0;
+PFNGLMULTITEXCOORD4IVPROC    Extensions::glMultiTexCoord4iv = 0;
+PFNGLMULTITEXCOORD4SPROC    Extensions::glMultiTexCoord4s = 0;
+PFNGLMULTITEXCOORD4SVPROC    Extensions::glMultiTexCoord4sv = 0;
+PFNGLMULTITEXCOORDP1UIPROC    Extensions::glMultiTexCoordP1ui = 0;
+PFNGLMULTITEXCOORDP1UIVPROC    Extensions::glMultiTexCoordP1uiv = 0;
+PFNGLMULTITEXCOORDP2UIPROC    Extensions::glMultiTexCoordP2ui = 0;
+PFNGLMULTITEXCOORDP2UIVPROC    Extensions::glMultiTexCoordP2uiv = 0;
+PFNGLMULTITEXCOORDP3UIPROC    Extensions::glMultiTexCoordP3ui = 0;
+PFNGLMULTITEXCOORDP3UIVPROC    Extensions::glMultiTexCoordP3uiv = 0;
+PFNGLMULTITEXCOORDP4UIPROC    Extensions::glMultiTexCoordP4ui = 0;
+PFNGLMULTITEXCOORDP4UIVPROC    Extensions::glMultiTexCoordP4uiv = 0;
+PFNGLMULTTRANSPOSEMATRIXDPROC    Extensions::glMultTransposeMatrixd = 0;
+PFNGLMULTTRANSPOSEMATRIXFPROC    Extensions::glMultTransposeMatrixf = 0;
+PFNGLNAMEDBUFFERDATAPROC    Extensions::glNamedBufferData = 0;
+PFNGLNAMEDBUFFERSTORAGEPROC    Extensions::glNamedBufferStorage = 0;
+PFNGLNAMEDBUFFERSUBDATAPROC    Extensions::glNamedBufferSubData = 0;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC    Extensions::glNamedFramebufferDrawBuffer = 0;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC    Extensions::glNamedFramebufferDrawBuffers = 0;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC    Extensions::glNamedFramebufferParameteri = 0;
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC    Extensions::glNamedFramebufferReadBuffer = 0;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC    Extensions::glNamedFramebufferRenderbuffer = 0;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC    Extensions::glNamedFramebufferTexture = 0;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC    Extensions::glNamedFramebufferTextureLayer = 0;
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC    Extensions::glNamedRenderbufferStorage = 0;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC    Extensions::glNamedRenderbufferStorageMultisample = 0;
+PFNGLNORMALP3UIPROC    Extensions::glNormalP3ui = 0;
+PFNGLNORMALP3UIVPROC    Extensions::glNormalP3uiv = 0;
+PFNGLOBJECTLABELPROC    Extensions::glObjectLabel = 0;
+PFNGLOBJECTPTRLABELPROC    Extensions::glObjectPtrLabel = 0;
+PFNGLPATCHPARAMETERFVPROC    Extensions::glPatchParameterfv = 0;
+PFNGLPATCHPARAMETERIPROC    Extensions::glPatchParameteri = 0;
+PFNGLPAUSETRANSFORMFEEDBACKPROC    Extensions::glPauseTransformFeedback = 0;
+PFNGLPOINTPARAMETERFPROC    Extensions::glPointParameterf = 0;
+PFNGLPOINTPARAMETERFVPROC    Extensions::glPointParameterfv = 0;
+PFNGLPOINTPARAMETERIPROC    Extensions::glPointParameteri = 0;
+PFNGLPOINTPARAMETERIVPROC    Extensions::glPointParameteriv = 0;
+PFNGLPOLYGONOFFSETCLAMPPROC    Extensions::glPolygonOffsetClamp = 0;
+PFNGLPOPDEBUGGROUPPROC    Extensions::glPopDebugGroup = 0;
+PFNGLPRIMITIVERESTARTINDEXPROC    Extensions::glPrimitiveRestartIndex = 0;
+PFNGLPROGRAMBINARYPROC    Extensions::glProgramBinary = 0;
+PFNGLPROGRAMPARAMETERIPROC    Extensions::glProgramParameteri = 0;
+PFNGLPROGRAMPARAMETERIEXTPROC    Extensions::glProgramParameteriEXT = 0;
+PFNGLPROGRAMUNIFORM1DPROC    Extensions::glProgramUniform1d = 0;
+PFNGLPROGRAMUNIFORM1DVPROC    Extensions::glProgramUniform1dv = 0;
+PFNGLPROGRAMUNIFORM1FPROC    Extensions::glProgramUniform1f = 0;
+PFNGLPROGRAMUNIFORM1FVPROC    Extensions::glProgramUniform1fv = 0;
+PFNGLPROGRAMUNIFORM1IPROC    Extensions::glProgramUniform1i = 0;
+PFNGLPROGRAMUNIFORM1IVPROC    Extensions::glProgramUniform1iv = 0;
+PFNGLPROGRAMUNIFORM1UIPROC    Extensions::glProgramUniform1ui = 0;
+PFNGLPROGRAMUNIFORM1UIVPROC    Extensions::glProgramUniform1uiv = 0;
+PFNGLPROGRAMUNIFORM2DPROC    Extensions::glProgramUniform2d = 0;
+PFNGLPROGRAMUNIFORM2DVPROC    Extensions::glProgramUniform2dv = 0;
+PFNGLPROGRAMUNIFORM2FPROC    Extensions::glProgramUniform2f = 0;
+PFNGLPROGRAMUNIFORM2FVPROC    Extensions::glProgramUniform2fv = 0;
+PFNGLPROGRAMUNIFORM2IPROC    Extensions::glProgramUniform2i = 0;
+PFNGLPROGRAMUNIFORM2IVPROC    Extensions::glProgramUniform2iv = 0;
+PFNGLPROGRAMUNIFORM2UIPROC    Extensions::glProgramUniform2ui = 0;
+PFNGLPROGRAMUNIFORM2UIVPROC    Extensions::glProgramUniform2uiv = 0;
+PFNGLPROGRAMUNIFORM3DPROC    Extensions::glProgramUniform3d = 0;
+PFNGLPROGRAMUNIFORM3DVPROC    Extensions::glProgramUniform3dv = 0;
+PFNGLPROGRAMUNIFORM3FPROC    Extensions::glProgramUniform3f = 0;
+PFNGLPROGRAMUNIFORM3FVPROC    Extensions::glProgramUniform3fv = 0;
+PFNGLPROGRAMUNIFORM3IPROC    Extensions::glProgramUniform3i = 0;
+PFNGLPROGRAMUNIFORM3IVPROC    Extensions::glProgramUniform3iv = 0;
+PFNGLPROGRAMUNIFORM3UIPROC    Extensions::glProgramUniform3ui = 0;
+PFNGLPROGRAMUNIFORM3UIVPROC    Extensions::glProgramUniform3uiv = 0;
+PFNGLPROGRAMUNIFORM4DPROC    Extensions::glProgramUniform4d = 0;
+PFNGLPROGRAMUNIFORM4DVPROC    Extensions::glProgramUniform4dv = 0;
+PFNGLPROGRAMUNIFORM4FPROC    Extensions::glProgramUniform4f = 0;
+PFNGLPROGRAMUNIFORM4FVPROC    Extensions::glProgramUniform4fv = 0;
+PFNGLPROGRAMUNIFORM4IPROC    Extensions::glProgramUniform4i = 0;
+PFNGLPROGRAMUNIFORM4IVPROC    Extensions::glProgramUniform4iv = 0;
+PFNGLPROGRAMUNIFORM4UIPROC    Extensions::glProgramUniform4ui = 0;
+PFNGLPROGRAMUNIFORM4UIVPROC    Extensions::glProgramUniform4uiv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC    Extensions::glProgramUniformMatrix2dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC    Extensions::glProgramUniformMatrix2fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC    Extensions::glProgramUniformMatrix2x3dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC    Extensions::glProgramUniformMatrix2x3fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC    Extensions::glProgramUniformMatrix2x4dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC    Extensions::glProgramUniformMatrix2x4fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC    Extensions::glProgramUniformMatrix3dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC    Extensions::glProgramUniformMatrix3fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC    Extensions::glProgramUniformMatrix3x2dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC    Extensions::glProgramUniformMatrix3x2fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC    Extensions::glProgramUniformMatrix3x4dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC    Extensions::glProgramUniformMatrix3x4fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC    Extensions::glProgramUniformMatrix4dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC    Extensions::glProgramUniformMatrix4fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC    Extensions::glProgramUniformMatrix4x2dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC    Extensions::glProgramUniformMatrix4x2fv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC    Extensions::glProgramUniformMatrix4x3dv = 0;
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC    Extensions::glProgramUniformMatrix4x3fv = 0;
+PFNGLPROVOKINGVERTEXPROC    Extensions::glProvokingVertex = 0;
+PFNGLPUSHDEBUGGROUPPROC    Extensions::glPushDebugGroup = 0;
+PFNGLQUERYCOUNTERPROC    Extensions::glQueryCounter = 0;
+PFNGLREADNPIXELSPROC    Extensions::glReadnPixels = 0;
+PFNGLRELEASESHADERCOMPILERPROC    Extensions::glReleaseShaderCompiler = 0;
+PFNGLRENDERBUFFERSTORAGEPROC    Extensions::glRenderbufferStorage = 0;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC    Extensions::glRenderbufferStorageMultisample = 0;
+PFNGLRESUMETRANSFORMFEEDBACKPROC    Extensions::glResumeTransformFeedback = 0;
+PFNGLSAMPLECOVERAGEPROC    Extensions::glSampleCoverage = 0;
+PFNGLSAMPLEMASKIPROC    Extensions::glSampleMaski = 0;
+PFNGLSAMPLERPARAMETERFPROC    Extensions::glSamplerParameterf = 0;
+PFNGLSAMPLERPARAMETERFVPROC    Extensions::glSamplerParameterfv = 0;
+PFNGLSAMPLERPARAMETERIPROC    Extensions::glSamplerParameteri = 0;
+PFNGLSAMPLERPARAMETERIIVPROC    Extensions::glSamplerParameterIiv = 0;
+PFNGLSAMPLERPARAMETERIUIVPROC    Extensions::glSamplerParameterIuiv = 0;
+PFNGLSAMPLERPARAMETERIVPROC    Extensions::glSamplerParameteriv = 0;
+PFNGLSCISSORARRAYVPROC    Extensions::glScissorArrayv = 0;
+PFNGLSCISSORINDEXEDPROC    Extensions::glScissorIndexed = 0;
+PFNGLSCISSORINDEXEDVPROC    Extensions::glScissorIndexedv = 0;
+PFNGLSECONDARYCOLOR3BPROC    Extensions::glSecondaryColor3b = 0;
+PFNGLSECONDARYCOLOR3BVPROC    Extensions::glSecondaryColor3bv = 0;
+PFNGLSECONDARYCOLOR3DPROC    Extensions::glSecondaryColor3d = 0;
+PFNGLSECONDARYCOLOR3DVPROC    Extensions::glSecondaryColor3dv = 0;
+PFNGLSECONDARYCOLOR3FPROC    Extensions::glSecondaryColor3f = 0;
+PFNGLSECONDARYCOLOR3FVPROC    Extensions::glSecondaryColor3fv = 0;
+PFNGLSECONDARYCOLOR3IPROC    Extensions::glSecondaryColor3i = 0;
+PFNGLSECONDARYCOLOR3IVPROC    Extensions::glSecondaryColor3iv = 0;
+PFNGLSECONDARYCOLOR3SPROC    Extensions::glSecondaryColor3s = 0;
+PFNGLSECONDARYCOLOR3SVPROC    Extensions::glSecondaryColor3sv = 0;
+PFNGLSECONDARYCOLOR3UBPROC    Extensions::glSecondaryColor3ub = 0;
+PFNGLSECONDARYCOLOR3UBVPROC    Extensions::glSecondaryColor3ubv = 0;
+PFNGLSECONDARYCOLOR3UIPROC    Extensions::glSecondaryColor3ui = 0;
+PFNGLSECONDARYCOLOR3UIVPROC    Extensions::glSecondaryColor3uiv = 0;
+PFNGLSECONDARYCOLOR3USPROC    Extensions::glSecondaryColor3us = 0;
+PFNGLSECONDARYCOLOR3USVPROC    Extensions::glSecondaryColor3usv = 0;
+PFNGLSECONDARYCOLORP3UIPROC    Extensions::glSecondaryColorP3ui = 0;
+PFNGLSECONDARYCOLORP3UIVPROC    Extensions::glSecondaryColorP3uiv = 0;
+PFNGLSECONDARYCOLORPOINTERPROC    Extensions::glSecondaryColorPointer = 0;
+PFNGLSHADERBINARYPROC    Extensions::glShaderBinary = 0;
+PFNGLSHADERSOURCEPROC    Extensions::glShaderSource = 0;
+PFNGLSHADERSOURCEARBPROC    Extensions::glShaderSourceARB = 0;
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC    Extensions::glShaderStorageBlockBinding = 0;
+PFNGLSPECIALIZESHADERPROC    Extensions::glSpecializeShader = 0;
+PFNGLSTENCILFUNCSEPARATEPROC    Extensions::glStencilFuncSeparate = 0;
+PFNGLSTENCILMASKSEPARATEPROC    Extensions::glStencilMaskSeparate = 0;
+PFNGLSTENCILOPSEPARATEPROC    Extensions::glStencilOpSeparate = 0;
+PFNGLTEXBUFFERPROC    Extensions::glTexBuffer = 0;
+PFNGLTEXBUFFERRANGEPROC    Extensions::glTexBufferRange = 0;
+PFNGLTEXCOORDP1UIPROC    Extensions::glTexCoordP1ui = 0;
+PFNGLTEXCOORDP1UIVPROC    Extensions::glTexCoordP1uiv = 0;
+PFNGLTEXCOORDP2UIPROC    Extensions::glTexCoordP2ui = 0;
+PFNGLTEXCOORDP2UIVPROC    Extensions::glTexCoordP2uiv = 0;
+PFNGLTEXCOORDP3UIPROC    Extensions::glTexCoordP3ui = 0;
+PFNGLTEXCOORDP3UIVPROC    Extensions::glTexCoordP3uiv = 0;
+PFNGLTEXCOORDP4UIPROC    Extensions::glTexCoordP4ui = 0;
+PFNGLTEXCOORDP4UIVPROC    Extensions::glTexCoordP4uiv = 0;
+PFNGLTEXIMAGE2DMULTISAMPLEPROC    Extensions::glTexImage2DMultisample = 0;
+PFNGLTEXIMAGE3DPROC    Extensions::glTexImage3D = 0;
+PFNGLTEXIMAGE3DMULTISAMPLEPROC    Extensions::glTexImage3DMultisample = 0;
+PFNGLTEXPARAMETERIIVPROC    Extensions::glTexParameterIiv = 0;
+PFNGLTEXPARAMETERIUIVPROC    Extensions::glTexParameterIuiv = 0;
+PFNGLTEXSTORAGE1DPROC    Extensions::glTexStorage1D = 0;
+PFNGLTEXSTORAGE2DPROC    Extensions::glTexStorage2D = 0;
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC    Extensions::glTexStorage2DMultisample = 0;
+PFNGLTEXSTORAGE3DPROC    Extensions::glTexStorage3D = 0;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC    Extensions::glTexStorage3DMultisample = 0;
+PFNGLTEXSUBIMAGE3DPROC    Extensions::glTexSubImage3D = 0;
+PFNGLTEXTUREBARRIERPROC    Extensions::glTextureBarrier = 0;
+PFNGLTEXTUREBUFFERPROC    Extensions::glTextureBuffer = 0;
+PFNGLTEXTUREBUFFERRANGEPROC    Extensions::glTextureBufferRange = 0;
+PFNGLTEXTUREPARAMETERFPROC    Extensions::glTextureParameterf = 0;
+PFNGLTEXTUREPARAMETERFVPROC    Extensions::glTextureParameterfv = 0;
+PFNGLTEXTUREPARAMETERIPROC    Extensions::glTextureParameteri = 0;
+PFNGLTEXTUREPARAMETERIIVPROC    Extensions::glTextureParameterIiv = 0;
+PFNGLTEXTUREPARAMETERIUIVPROC    Extensions::glTextureParameterIuiv = 0;
+PFNGLTEXTUREPARAMETERIVPROC    Extensions::glTextureParameteriv = 0;
+PFNGLTEXTURESTORAGE1DPROC    Extensions::glTextureStorage1D = 0;
+PFNGLTEXTURESTORAGE2DPROC    Extensions::glTextureStorage2D = 0;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC    Extensions::glTextureStorage2DMultisample = 0;
+PFNGLTEXTURESTORAGE3DPROC    Extensions::glTextureStorage3D = 0;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC    Extensions::glTextureStorage3DMultisample = 0;
+PFNGLTEXTURESUBIMAGE1DPROC    Extensions::glTextureSubImage1D = 0;
+PFNGLTEXTURESUBIMAGE2DPROC    Extensions::glTextureSubImage2D = 0;
+PFNGLTEXTURESUBIMAGE3DPROC    Extensions::glTextureSubImage3D = 0;
+PFNGLTEXTUREVIEWPROC    Extensions::glTextureView = 0;
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC    Extensions::glTransformFeedbackBufferBase = 0;
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC    Extensions::glTransformFeedbackBufferRange = 0;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC    Extensions::glTransformFeedbackVaryings = 0;
+PFNGLUNIFORM1DPROC    Extensions::glUniform1d = 0;
+PFNGLUNIFORM1DVPROC    Extensions::glUniform1dv = 0;
+PFNGLUNIFORM1FPROC    Extensions::glUniform1f = 0;
+PFNGLUNIFORM1FARBPROC    Extensions::glUniform1fARB = 0;
+PFNGLUNIFORM1FVPROC    Extensions::glUniform1fv = 0;
+PFNGLUNIFORM1FVARBPROC    Extensions::glUniform1fvARB = 0;
+PFNGLUNIFORM1IPROC    Extensions::glUniform1i = 0;
+PFNGLUNIFORM1IARBPROC    Extensions::glUniform1iARB = 0;
+PFNGLUNIFORM1IVPROC    Extensions::glUniform1iv = 0;
+PFNGLUNIFORM1IVARBPROC    Extensions::glUniform1ivARB = 0;
+PFNGLUNIFORM1UIPROC    Extensions::glUniform1ui = 0;
+PFNGLUNIFORM1UIVPROC    Extensions::glUniform1uiv = 0;
+PFNGLUNIFORM2DPROC    Extensions::glUniform2d = 0;
+PFNGLUNIFORM2DVPROC    Extensions::glUniform2dv = 0;
+PFNGLUNIFORM2FPROC    Extensions::glUniform2f = 0;
+PFNGLUNIFORM2FARBPROC    Extensions::glUniform2fARB = 0;
+PFNGLUNIFORM2FVPROC    Extensions::glUniform2fv = 0;
+PFNGLUNIFORM2FVARBPROC    Extensions::glUniform2fvARB = 0;
+PFNGLUNIFORM2IPROC    Extensions::glUniform2i = 0;
+PFNGLUNIFORM2IARBPROC    Extensions::glUniform2iARB = 0;
+PFNGLUNIFORM2IVPROC    Extensions::glUniform2iv = 0;
+PFNGLUNIFORM2IVARBPROC    Extensions::glUniform2ivARB = 0;
+PFNGLUNIFORM2UIPROC    Extensions::glUniform2ui = 0;
+PFNGLUNIFORM2UIVPROC    Extensions::glUniform2uiv = 0;
+PFNGLUNIFORM3DPROC    Extensions::glUniform3d = 0;
+PFNGLUNIFORM3DVPROC    Extensions::glUniform3dv = 0;
+PFNGLUNIFORM3FPROC    Extensions::glUniform3f = 0;
+PFNGLUNIFORM3FARBPROC    Extensions::glUniform3fARB = 0;
+PFNGLUNIFORM3FVPROC    Extensions::glUniform3fv = 0;
+PFNGLUNIFORM3FVARBPROC    Extensions::glUniform3fvARB = 0;
+PFNGLUNIFORM3IPROC    Extensions::glUniform3i = 0;
+PFNGLUNIFORM3IARBPROC    Extensions::glUniform3iARB = 0;
+PFNGLUNIFORM3IVPROC    Extensions::glUniform3iv = 0;
+PFNGLUNIFORM3IVARBPROC    Extensions::glUniform3ivARB = 0;
+PFNGLUNIFORM3UIPROC    Extensions::glUniform3ui = 0;
+PFNGLUNIFORM3UIVPROC    Extensions::glUniform3uiv = 0;
+PFNGLUNIFORM4DPROC    Extensions::glUniform4d = 0;
+PFNGLUNIFORM4DVPROC    Extensions::glUniform4dv = 0;
+PFNGLUNIFORM4FPROC    Extensions::glUniform4f = 0;
+PFNGLUNIFORM4FARBPROC    Extensions::glUniform4fARB = 0;
+PFNGLUNIFORM4FVPROC    Extensions::glUniform4fv = 0;
+PFNGLUNIFORM4FVARBPROC    Extensions::glUniform4fvARB = 0;
+PFNGLUNIFORM4IPROC    Extensions::glUniform4i = 0;
+PFNGLUNIFORM4IARBPROC    Extensions::glUniform4iARB = 0;
+PFNGLUNIFORM4IVPROC    Extensions::glUniform4iv = 0;
+PFNGLUNIFORM4IVARBPROC    Extensions::glUniform4ivARB = 0;
+PFNGLUNIFORM4UIPROC    Extensions::glUniform4ui = 0;
+PFNGLUNIFORM4UIVPROC    Extensions::glUniform4uiv = 0;
+PFNGLUNIFORMBLOCKBINDINGPROC    Extensions::glUniformBlockBinding = 0;
+PFNGLUNIFORMMATRIX2DVPROC    Extensions::glUniformMatrix2dv = 0;
+PFNGLUNIFORMMATRIX2FVPROC    Extensions::glUniformMatrix2fv = 0;
+PFNGLUNIFORMMATRIX2FVARBPROC    Extensions::glUniformMatrix2fvARB = 0;
+PFNGLUNIFORMMATRIX2X3DVPROC    Extensions::glUniformMatrix2x3dv = 0;
+PFNGLUNIFORMMATRIX2X3FVPROC    Extensions::glUniformMatrix2x3fv = 0;
+PFNGLUNIFORMMATRIX2X4DVPROC    Extensions::glUniformMatrix2x4dv = 0;
+PFNGLUNIFORMMATRIX2X4FVPROC    Extensions::glUniformMatrix2x4fv = 0;
+PFNGLUNIFORMMATRIX3DVPROC    Extensions::glUniformMatrix3dv = 0;
+PFNGLUNIFORMMATRIX3FVPROC    Extensions::glUniformMatrix3fv = 0;
+PFNGLUNIFORMMATRIX3FVARBPROC    Extensions::glUniformMatrix3fvARB = 0;
+PFNGLUNIFORMMATRIX3X2DVPROC    Extensions::glUniformMatrix3x2dv = 0;
+PFNGLUNIFORMMATRIX3X2FVPROC    Extensions::glUniformMatrix3x2fv = 0;
+PFNGLUNIFORMMATRIX3X4DVPROC    Extensions::glUniformMatrix3x4dv = 0;
+PFNGLUNIFORMMATRIX3X4FVPROC    Extensions::glUniformMatrix3x4fv = 0;
+PFNGLUNIFORMMATRIX4DVPROC    Extensions::glUniformMatrix4dv = 0;
+PFNGLUNIFORMMATRIX4FVPROC    Extensions::glUniformMatrix4fv = 0;
+PFNGLUNIFORMMATRIX4FVARBPROC    Extensions::glUniformMatrix4fvARB = 0;
+PFNGLUNIFORMMATRIX4X2DVPROC    Extensions::glUniformMatrix4x2dv = 0;
+PFNGLUNIFORMMATRIX4X2FVPROC    Extensions::glUniformMatrix4x2fv = 0;
+PFNGLUNIFORMMATRIX4X3DVPROC    Extensions::glUniformMatrix4x3dv = 0;
+PFNGLUNIFORMMATRIX4X3FVPROC    Extensions::glUniformMatrix4x3fv = 0;
+PFNGLUNIFORMSUBROUTINESUIVPROC    Extensions::glUniformSubroutinesuiv = 0;
+PFNGLUNMAPBUFFERPROC    Extensions::glUnmapBuffer = 0;
+PFNGLUNMAPNAMEDBUFFERPROC    Extensions::glUnmapNamedBuffer = 0;
+PFNGLUSEPROGRAMPROC    Extensions::glUseProgram = 0;
+PFNGLUSEPROGRAMOBJECTARBPROC    Extensions::glUseProgramObjectARB = 0;
+PFNGLUSEPROGRAMSTAGESPROC    Extensions::glUseProgramStages = 0;
+PFNGLVALIDATEPROGRAMPROC    Extensions::glValidateProgram = 0;
+PFNGLVALIDATEPROGRAMARBPROC    Extensions::glValidateProgramARB = 0;
+PFNGLVALIDATEPROGRAMPIPELINEPROC    Extensions::glValidateProgramPipeline = 0;
+PFNGLVERTEXARRAYATTRIBBINDINGPROC    Extensions::glVertexArrayAttribBinding = 0;
+PFNGLVERTEXARRAYATTRIBFORMATPROC    Extensions::glVertexArrayAttribFormat = 0;
+PFNGLVERTEXARRAYATTRIBIFORMATPROC    Extensions::glVertexArrayAttribIFormat = 0;
+PFNGLVERTEXARRAYATTRIBLFORMATPROC    Extensions::glVertexArrayAttribLFormat = 0;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC    Extensions::glVertexArrayBindingDivisor = 0;
+PFNGLVERTEXARRAYELEMENTBUFFERPROC    Extensions::glVertexArrayElementBuffer = 0;
+PFNGLVERTEXARRAYVERTEXBUFFERPROC    Extensions::glVertexArrayVertexBuffer = 0;
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC    Extensions::glVertexArrayVertexBuffers = 0;
+PFNGLVERTEXATTRIB1DPROC    Extensions::glVertexAttrib1d = 0;
+PFNGLVERTEXATTRIB1DVPROC    Extensions::glVertexAttrib1dv = 0;
+PFNGLVERTEXATTRIB1FPROC    Extensions::glVertexAttrib1f = 0;
+PFNGLVERTEXATTRIB1FVPROC    Extensions::glVertexAttrib1fv = 0;
+PFNGLVERTEXATTRIB1SPROC    Extensions::glVertexAttrib1s = 0;
+PFNGLVERTEXATTRIB1SVPROC    Extensions::glVertexAttrib1sv = 0;
+PFNGLVERTEXATTRIB2DPROC    Extensions::glVertexAttrib2d = 0;
+PFNGLVERTEXATTRIB2DVPROC    Extensions::glVertexAttrib2dv = 0;
+PFNGLVERTEXATTRIB2FPROC    Extensions::glVertexAttrib2f = 0;
+PFNGLVERTEXATTRIB2FVPROC    Extensions::glVertexAttrib2fv = 0;
+PFNGLVERTEXATTRIB2SPROC    Extensions::glVertexAttrib2s = 0;
+PFNGLVERTEXATTRIB2SVPROC    Extensions::glVertexAttrib2sv = 0;
+PFNGLVERTEXATTRIB3DPROC    Extensions::glVertexAttrib3d = 0;
+PFNGLVERTEXATTRIB3DVPROC    Extensions::glVertexAttrib3dv = 0;
+PFNGLVERTEXATTRIB3FPROC    Extensions::glVertexAttrib3f = 0;
+PFNGLVERTEXATTRIB3FVPROC    Extensions::glVertexAttrib3fv = 0;
+PFNGLVERTEXATTRIB3SPROC    Extensions::glVertexAttrib3s = 0;
+PFNGLVERTEXATTRIB3SVPROC    Extensions::glVertexAttrib3sv = 0;
+PFNGLVERTEXATTRIB4BVPROC    Extensions::glVertexAttrib4bv = 0;
+PFNGLVERTEXATTRIB4DPROC    Extensions::glVertexAttrib4d = 0;
+PFNGLVERTEXATTRIB4DVPROC    Extensions::glVertexAttrib4dv = 0;
+PFNGLVERTEXATTRIB4FPROC    Extensions::glVertexAttrib4f = 0;
+PFNGLVERTEXATTRIB4FVPROC    Extensions::glVertexAttrib4fv = 0;
+PFNGLVERTEXATTRIB4IVPROC    Extensions::glVertexAttrib4iv = 0;
+PFNGLVERTEXATTRIB4NBVPROC    Extensions::glVertexAttrib4Nbv = 0;
+PFNGLVERTEXATTRIB4NIVPROC    Extensions::glVertexAttrib4Niv = 0;
+PFNGLVERTEXATTRIB4NSVPROC    Extensions::glVertexAttrib4Nsv = 0;
+PFNGLVERTEXATTRIB4NUBPROC    Extensions::glVertexAttrib4Nub = 0;
+PFNGLVERTEXATTRIB4NUBVPROC    Extensions::glVertexAttrib4Nubv = 0;
+PFNGLVERTEXATTRIB4NUIVPROC    Extensions::glVertexAttrib4Nuiv = 0;
+PFNGLVERTEXATTRIB4NUSVPROC    Extensions::glVertexAttrib4Nusv = 0;
+PFNGLVERTEXATTRIB4SPROC    Extensions::glVertexAttrib4s = 0;
+PFNGLVERTEXATTRIB4SVPROC    Extensions::glVertexAttrib4sv = 0;
+PFNGLVERTEXATTRIB4UBVPROC    Extensions::glVertexAttrib4ubv = 0;
+PFNGLVERTEXATTRIB4UIVPROC    Extensions::glVertexAttrib4uiv = 0;
+PFNGLVERTEXATTRIB4USVPROC    Extensions::glVertexAttrib4usv = 0;
+PFNGLVERTEXATTRIBBINDINGPROC    Extensions::glVertexAttribBinding = 0;
+PFNGLVERTEXATTRIBDIVISORPROC    Extensions::glVertexAttribDivisor = 0;
+PFNGLVERTEXATTRIBFORMATPROC    Extensions::glVertexAttribFormat = 0;
+PFNGLVERTEXATTRIBI1IPROC    Extensions::glVertexAttribI1i = 0;
+PFNGLVERTEXATTRIBI1IVPROC    Extensions::glVertexAttribI1iv = 0;
+PFNGLVERTEXATTRIBI1UIPROC    Extensions::glVertexAttribI1ui = 0;
+PFNGLVERTEXATTRIBI1UIVPROC    Extensions::glVertexAttribI1uiv = 0;
+PFNGLVERTEXATTRIBI2IPROC    Extensions::glVertexAttribI2i = 0;
+PFNGLVERTEXATTRIBI2IVPROC    Extensions::glVertexAttribI2iv = 0;
+PFNGLVERTEXATTRIBI2UIPROC    Extensions::glVertexAttribI2ui = 0;
+PFNGLVERTEXATTRIBI2UIVPROC    Extensions::glVertexAttribI2uiv = 0;
+PFNGLVERTEXATTRIBI3IPROC    Extensions::glVertexAttribI3i = 0;
+PFNGLVERTEXATTRIBI3IVPROC    Extensions::glVertexAttribI3iv = 0;
+PFNGLVERTEXATTRIBI3UIPROC    Extensions::glVertexAttribI3ui = 0;
+PFNGLVERTEXATTRIBI3UIVPROC    Extensions::glVertexAttribI3uiv = 0;
+PFNGLVERTEXATTRIBI4BVPROC    Extensions::glVertexAttribI4bv = 0;
+PFNGLVERTEXATTRIBI4IPROC    Extensions::glVertexAttribI4i = 0;
+PFNGLVERTEXATTRIBI4IVPROC    Extensions::glVertexAttribI4iv = 0;
+PFNGLVERTEXATTRIBI4SVPROC    Extensions::glVertexAttribI4sv = 0;
+PFNGLVERTEXATTRIBI4UBVPROC    Extensions::glVertexAttribI4ubv = 0;
+PFNGLVERTEXATTRIBI4UIPROC    Extensions::glVertexAttribI4ui = 0;
+PFNGLVERTEXATTRIBI4UIVPROC    Extensions::glVertexAttribI4uiv = 0;
+PFNGLVERTEXATTRIBI4USVPROC    Extensions::glVertexAttribI4usv = 0;
+PFNGLVERTEXATTRIBIFORMATPROC    Extensions::glVertexAttribIFormat = 0;
+PFNGLVERTEXATTRIBIPOINTERPROC    Extensions::glVertexAttribIPointer = 0;
+PFNGLVERTEXATTRIBL1DPROC    Extensions::glVertexAttribL1d = 0;
+PFNGLVERTEXATTRIBL1DVPROC    Extensions::glVertexAttribL1dv = 0;
+PFNGLVERTEXATTRIBL2DPROC    Extensions::glVertexAttribL2d = 0;
+PFNGLVERTEXATTRIBL2DVPROC    Extensions::glVertexAttribL2dv = 0;
+PFNGLVERTEXATTRIBL3DPROC    Extensions::glVertexAttribL3d = 0;
+PFNGLVERTEXATTRIBL3DVPROC    Extensions::glVertexAttribL3dv = 0;
+PFNGLVERTEXATTRIBL4DPROC    Extensions::glVertexAttribL4d = 0;
+PFNGLVERTEXATTRIBL4DVPROC    Extensions::glVertexAttribL4dv = 0;
+PFNGLVERTEXATTRIBLFORMATPROC    Extensions::glVertexAttribLFormat = 0;
+PFNGLVERTEXATTRIBLPOINTERPROC    Extensions::glVertexAttribLPointer = 0;
+PFNGLVERTEXATTRIBP1UIPROC    Extensions::glVertexAttribP1ui = 0;
+PFNGLVERTEXATTRIBP1UIVPROC    Extensions::glVertexAttribP1uiv = 0;
+PFNGLVERTEXATTRIBP2UIPROC    Extensions::glVertexAttribP2ui = 0;
+PFNGLVERTEXATTRIBP2UIVPROC    Extensions::glVertexAttribP2uiv = 0;
+PFNGLVERTEXATTRIBP3UIPROC    Extensions::glVertexAttribP3ui = 0;
+PFNGLVERTEXATTRIBP3UIVPROC    Extensions::glVertexAttribP3uiv = 0;
+PFNGLVERTEXATTRIBP4UIPROC    Extensions::glVertexAttribP4ui = 0;
+PFNGLVERTEXATTRIBP4UIVPROC    Extensions::glVertexAttribP4uiv = 0;
+PFNGLVERTEXATTRIBPOINTERPROC    Extensions::glVertexAttribPointer = 0;
+PFNGLVERTEXBINDINGDIVISORPROC    Extensions::glVertexBindingDivisor = 0;
+PFNGLVERTEXP2UIPROC    Extensions::glVertexP2ui = 0;
+PFNGLVERTEXP2UIVPROC    Extensions::glVertexP2uiv = 0;
+PFNGLVERTEXP3UIPROC    Extensions::glVertexP3ui = 0;
+PFNGLVERTEXP3UIVPROC    Extensions::glVertexP3uiv = 0;
+PFNGLVERTEXP4UIPROC    Extensions::glVertexP4ui = 0;
+PFNGLVERTEXP4UIVPROC    Extensions::glVertexP4uiv = 0;
+PFNGLVIEWPORTARRAYVPROC    Extensions::glViewportArrayv = 0;
+PFNGLVIEWPORTINDEXEDFPROC    Extensions::glViewportIndexedf = 0;
+PFNGLVIEWPORTINDEXEDFVPROC    Extensions::glViewportIndexedfv = 0;
+PFNGLWAITSYNCPROC    Extensions::glWaitSync = 0;
+PFNGLWINDOWPOS2DPROC    Extensions::glWindowPos2d = 0;
+PFNGLWINDOWPOS2DVPROC    Extensions::glWindowPos2dv = 0;
+PFNGLWINDOWPOS2FPROC    Extensions::glWindowPos2f = 0;
+PFNGLWINDOWPOS2FVPROC    Extensions::glWindowPos2fv = 0;
+PFNGLWINDOWPOS2IPROC    Extensions::glWindowPos2i = 0;
+PFNGLWINDOWPOS2IVPROC    Extensions::glWindowPos2iv = 0;
+PFNGLWINDOWPOS2SPROC    Extensions::glWindowPos2s = 0;
+PFNGLWINDOWPOS2SVPROC    Extensions::glWindowPos2sv = 0;
+PFNGLWINDOWPOS3DPROC    Extensions::glWindowPos3d = 0;
+PFNGLWINDOWPOS3DVPROC    Extensions::glWindowPos3dv = 0;
+PFNGLWINDOWPOS3FPROC    Extensions::glWindowPos3f = 0;
+PFNGLWINDOWPOS3FVPROC    Extensions::glWindowPos3fv = 0;
+PFNGLWINDOWPOS3IPROC    Extensions::glWindowPos3i = 0;
+PFNGLWINDOWPOS3IVPROC    Extensions::glWindowPos3iv = 0;
+PFNGLWINDOWPOS3SPROC    Extensions::glWindowPos3s = 0;
+PFNGLWINDOWPOS3SVPROC    Extensions::glWindowPos3sv = 0;
 #else
 #endif // WIN32
 
 
-COglExtensions::COglExtensions()
+Extensions::Extensions()
 {
     hasVBOSupport();
 }
 
-bool COglExtensions::hasVBOSupport()
+bool Extensions::hasVBOSupport()
 {
 #ifdef WIN32
     if (!wglGetCurrentContext())
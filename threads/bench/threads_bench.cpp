@@ -0,0 +1,859 @@
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+/*
+	Benchmarks for the threads library, containers, local_heap, object_pool and the thread pool, against their std
+	equivalents.
+
+	threads_bench [--quick] [--reps N] [--filter text] [--format json|csv] [--out file]
+
+	Results go to stdout, or to --out, as json (default) or csv. Times are nanoseconds per operation, median and min over
+	--reps repetitions. Each row is named suite/name/variant, --filter keeps the rows containing the text.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <MultiCoreUtil.h>
+#include <local_heap.h>
+#include <pool_vector.h>
+#include <pool_small_vector.h>
+#include <pool_soa_vector.h>
+#include <pool_set.h>
+#include <pool_map.h>
+#include <pool_unordered_map.h>
+#include <pool_concurrent_map.h>
+#include <pool_object_pool.h>
+
+using namespace std;
+
+namespace {
+
+struct Options {
+	bool _quick = false;
+	size_t _reps = 5;
+	string _filter;
+	string _format = "json";
+	string _outPath;
+};
+
+struct Result {
+	string _suite, _name, _variant;
+	size_t _threads;
+	size_t _ops;
+	double _nsPerOp, _minNsPerOp;
+};
+
+Options g_options;
+vector<Result> g_results;
+
+#if defined(__GNUC__)
+template<class T>
+inline void doNotOptimize(const T& val)
+{
+	asm volatile("" : : "r,m"(val) : "memory");
+}
+#else
+const void* volatile g_pSink;
+
+template<class T>
+inline void doNotOptimize(const T& val)
+{
+	g_pSink = &val;
+}
+#endif
+
+// Deterministic, cheap random numbers so every run and every variant sees the same sequence
+struct Lcg {
+	uint64_t _state;
+
+	Lcg(uint64_t seed = 0x9e3779b97f4a7c15ull)
+		: _state(seed)
+	{}
+
+	inline uint32_t operator()()
+	{
+		_state = _state * 6364136223846793005ull + 1442695040888963407ull;
+		return (uint32_t)(_state >> 33);
+	}
+};
+
+size_t scaled(size_t num)
+{
+	return g_options._quick ? max<size_t>(num / 10, 1) : num;
+}
+
+bool isSelected(const string& suite, const string& name, const string& variant)
+{
+	if (g_options._filter.empty())
+		return true;
+
+	string fullName = suite + "/" + name + "/" + variant;
+	return fullName.find(g_options._filter) != string::npos;
+}
+
+/*
+	Runs f once to warm up, then _reps times. f performs ops operations. setup, if given, runs untimed before each call.
+*/
+void measure(const string& suite, const string& name, const string& variant, size_t threads, size_t ops,
+	const function<void()>& f, const function<void()>& setup = nullptr)
+{
+	if (!isSelected(suite, name, variant))
+		return;
+
+	using Clock = chrono::steady_clock;
+
+	vector<double> samples;
+	for (size_t rep = 0; rep <= g_options._reps; rep++) {
+		if (setup)
+			setup();
+
+		auto start = Clock::now();
+		f();
+		auto stop = Clock::now();
+
+		if (rep > 0)
+			samples.push_back(chrono::duration<double, nano>(stop - start).count() / ops);
+	}
+
+	sort(samples.begin(), samples.end());
+	Result res = { suite, name, variant, threads, ops, samples[samples.size() / 2], samples.front() };
+	g_results.push_back(res);
+
+	fprintf(stderr, "%-16s %-24s %-20s %3zu threads %12.2f ns/op\n", suite.c_str(), name.c_str(), variant.c_str(), threads, res._nsPerOp);
+}
+
+vector<size_t> threadCounts(size_t maxThreads)
+{
+	vector<size_t> result;
+	for (size_t n = 1; n <= maxThreads; n *= 2)
+		result.push_back(n);
+	return result;
+}
+
+// Runs f(threadNum) on numThreads threads, started together
+void runThreads(size_t numThreads, const function<void(size_t)>& f)
+{
+	atomic<size_t> numReady = 0;
+	vector<thread> threads;
+	threads.reserve(numThreads);
+	for (size_t i = 0; i < numThreads; i++) {
+		threads.push_back(thread([&, i]() {
+			numReady++;
+			while (numReady.load() < numThreads)
+				this_thread::yield();
+			f(i);
+		}));
+	}
+
+	for (auto& t : threads)
+		t.join();
+}
+
+double busyWork(size_t idx)
+{
+	double val = (double)idx;
+	for (size_t i = 0; i < 2000; i++)
+		val = val * 0.999999 + 1.0;
+	return val;
+}
+
+void benchThreadPool()
+{
+	const string suite = "thread_pool";
+
+	MultiCore::ThreadPool pool;
+	size_t numThreads = pool.getNumThreads();
+
+	size_t numDispatches = scaled(2000);
+	measure(suite, "dispatch_latency", "empty", numThreads, numDispatches, [&]() {
+		for (size_t i = 0; i < numDispatches; i++)
+			pool.run(numThreads, [](size_t, size_t) {}, true);
+	});
+
+	size_t numSteps = 4096;
+	vector<double> results(numSteps);
+	measure(suite, "run", "single", 1, numSteps, [&]() {
+		pool.run(numSteps, [&](size_t, size_t idx) { results[idx] = busyWork(idx); }, false);
+		doNotOptimize(results.data());
+	});
+	measure(suite, "run", "multi", numThreads, numSteps, [&]() {
+		pool.run(numSteps, [&](size_t, size_t idx) { results[idx] = busyWork(idx); }, true);
+		doNotOptimize(results.data());
+	});
+
+	// Scheduling modes, recording overhead and replay of a recorded shuffle
+	auto runMulti = [&]() {
+		pool.run(numSteps, [&](size_t, size_t idx) { results[idx] = busyWork(idx); }, true);
+		doNotOptimize(results.data());
+	};
+
+	pool.setScheduleMode(MultiCore::SCHEDULE_SHUFFLE, 1);
+	measure(suite, "run_schedule", "shuffle", numThreads, numSteps, runMulti);
+
+	pool.setRecording(true);
+	measure(suite, "run_schedule", "shuffle_record", numThreads, numSteps, runMulti, [&]() {
+		pool.clearRecordedSchedules();
+	});
+	pool.setRecording(false);
+
+	if (!pool.getRecordedSchedules().empty()) {
+		auto recorded = pool.getRecordedSchedules();
+		pool.setScheduleMode(MultiCore::SCHEDULE_REPLAY);
+		measure(suite, "run_schedule", "replay", numThreads, numSteps, runMulti, [&]() {
+			pool.setReplaySchedules(recorded);
+		});
+	}
+	pool.setScheduleMode(MultiCore::SCHEDULE_STRIDED);
+	pool.clearRecordedSchedules();
+}
+
+void benchRunLambda()
+{
+	const string suite = "run_lambda";
+
+	size_t numCores = MultiCore::getNumCores();
+	size_t numIndices = 4096;
+	vector<double> results(numIndices);
+
+	for (bool multiCore : { false, true }) {
+		string variant = multiCore ? "multi" : "single";
+		size_t threads = multiCore ? numCores : 1;
+
+		measure(suite, "index_range", variant, threads, numIndices, [&]() {
+			MultiCore::runLambda([&](size_t idx)->bool {
+				results[idx] = busyWork(idx);
+				return true;
+			}, numIndices, multiCore);
+			doNotOptimize(results.data());
+		});
+
+		vector<size_t> indexPool;
+		measure(suite, "index_pool", variant, threads, numIndices, [&]() {
+			MultiCore::runLambda([&](size_t idx)->bool {
+				results[idx] = busyWork(idx);
+				return true;
+			}, indexPool, multiCore);
+			doNotOptimize(results.data());
+		}, [&]() {
+			indexPool.resize(numIndices);
+			for (size_t i = 0; i < numIndices; i++)
+				indexPool[i] = i;
+		});
+
+		measure(suite, "per_thread", variant, threads, numIndices, [&]() {
+			MultiCore::runLambda([&](size_t threadNum, size_t numThreads) {
+				for (size_t idx = threadNum; idx < numIndices; idx += numThreads)
+					results[idx] = busyWork(idx);
+			}, multiCore);
+			doNotOptimize(results.data());
+		});
+	}
+}
+
+/*
+	Keeps numSlots live blocks of random size and replaces one at random per operation
+*/
+template<class ALLOC, class FREE>
+void allocChurn(size_t numOps, ALLOC allocFunc, FREE freeFunc)
+{
+	const size_t numSlots = 4096;
+	vector<pair<void*, size_t>> slots(numSlots, pair<void*, size_t>(nullptr, 0));
+
+	Lcg rand;
+	for (size_t i = 0; i < numOps; i++) {
+		auto& slot = slots[rand() % numSlots];
+		if (slot.first)
+			freeFunc(slot.first, slot.second);
+		slot.second = 8 + rand() % 505;
+		slot.first = allocFunc(slot.second);
+		*(char*)slot.first = (char)i;
+	}
+
+	for (auto& slot : slots) {
+		if (slot.first)
+			freeFunc(slot.first, slot.second);
+	}
+}
+
+void benchLocalHeap()
+{
+	const string suite = "local_heap";
+	size_t numOps = scaled(2000000);
+
+	measure(suite, "churn", "local_heap", 1, numOps, [&]() {
+		MultiCore::local_heap heap(256);
+		allocChurn(numOps, [&](size_t bytes)->void* {
+			return heap.alloc<char>(bytes);
+		}, [&](void* p, size_t) {
+			char* pc = (char*)p;
+			heap.free(pc);
+		});
+	});
+
+	measure(suite, "churn", "malloc", 1, numOps, [&]() {
+		allocChurn(numOps, [](size_t bytes)->void* {
+			return malloc(bytes);
+		}, [](void* p, size_t) {
+			free(p);
+		});
+	});
+
+	measure(suite, "churn", "pmr_unsync_pool", 1, numOps, [&]() {
+		pmr::unsynchronized_pool_resource res;
+		allocChurn(numOps, [&](size_t bytes)->void* {
+			return res.allocate(bytes);
+		}, [&](void* p, size_t bytes) {
+			res.deallocate(p, bytes);
+		});
+	});
+
+	measure(suite, "churn", "pmr_sync_pool", 1, numOps, [&]() {
+		pmr::synchronized_pool_resource res;
+		allocChurn(numOps, [&](size_t bytes)->void* {
+			return res.allocate(bytes);
+		}, [&](void* p, size_t bytes) {
+			res.deallocate(p, bytes);
+		});
+	});
+
+	// One heap per thread, the use case local_heap was written for, against the shared malloc
+	size_t numCores = MultiCore::getNumCores();
+	size_t opsPerThread = numOps / numCores + 1;
+	measure(suite, "churn_threaded", "local_heap", numCores, opsPerThread * numCores, [&]() {
+		runThreads(numCores, [&](size_t) {
+			MultiCore::local_heap heap(256);
+			allocChurn(opsPerThread, [&](size_t bytes)->void* {
+				return heap.alloc<char>(bytes);
+			}, [&](void* p, size_t) {
+				char* pc = (char*)p;
+				heap.free(pc);
+			});
+		});
+	});
+
+	measure(suite, "churn_threaded", "malloc", numCores, opsPerThread * numCores, [&]() {
+		runThreads(numCores, [&](size_t) {
+			allocChurn(opsPerThread, [](size_t bytes)->void* {
+				return malloc(bytes);
+			}, [](void* p, size_t) {
+				free(p);
+			});
+		});
+	});
+}
+
+struct Vertex {
+	float _pt[3];
+	float _norm[3];
+	float _uv[2];
+};
+
+void benchVector()
+{
+	const string suite = "vector";
+
+	MultiCore::local_heap heap(256);
+	MultiCore::scoped_set_local_heap heapSetter(&heap);
+
+	size_t num = scaled(1000000);
+	measure(suite, "push_back", "MultiCore", 1, num, [&]() {
+		MultiCore::vector<int> vec;
+		for (size_t i = 0; i < num; i++)
+			vec.push_back((int)i);
+		doNotOptimize(vec.data());
+	});
+	measure(suite, "push_back", "std", 1, num, [&]() {
+		std::vector<int> vec;
+		for (size_t i = 0; i < num; i++)
+			vec.push_back((int)i);
+		doNotOptimize(vec.data());
+	});
+
+	// Containers reused per block, clear keeps the capacity
+	size_t numRefills = scaled(1000), refillSize = 1000;
+	MultiCore::vector<int> reused;
+	measure(suite, "clear_refill", "MultiCore", 1, numRefills * refillSize, [&]() {
+		for (size_t i = 0; i < numRefills; i++) {
+			reused.clear();
+			for (size_t j = 0; j < refillSize; j++)
+				reused.push_back((int)j);
+			doNotOptimize(reused.data());
+		}
+	});
+	std::vector<int> stdReused;
+	measure(suite, "clear_refill", "std", 1, numRefills * refillSize, [&]() {
+		for (size_t i = 0; i < numRefills; i++) {
+			stdReused.clear();
+			for (size_t j = 0; j < refillSize; j++)
+				stdReused.push_back((int)j);
+			doNotOptimize(stdReused.data());
+		}
+	});
+
+	// Many short lists, such as cell adjacency
+	size_t numLists = scaled(200000);
+	measure(suite, "short_lists", "small_vector", 1, numLists, [&]() {
+		for (size_t i = 0; i < numLists; i++) {
+			MultiCore::small_vector<int, 8> vec;
+			for (int j = 0; j < 6; j++)
+				vec.push_back(j);
+			doNotOptimize(vec.data());
+		}
+	});
+	measure(suite, "short_lists", "MultiCore", 1, numLists, [&]() {
+		for (size_t i = 0; i < numLists; i++) {
+			MultiCore::vector<int> vec;
+			for (int j = 0; j < 6; j++)
+				vec.push_back(j);
+			doNotOptimize(vec.data());
+		}
+	});
+	measure(suite, "short_lists", "std", 1, numLists, [&]() {
+		for (size_t i = 0; i < numLists; i++) {
+			std::vector<int> vec;
+			for (int j = 0; j < 6; j++)
+				vec.push_back(j);
+			doNotOptimize(vec.data());
+		}
+	});
+
+	size_t numVerts = scaled(1000000);
+	measure(suite, "vertex_push_back", "soa_vector", 1, numVerts, [&]() {
+		MultiCore::soa_vector<float, float, float, float, float, float, float, float> verts;
+		for (size_t i = 0; i < numVerts; i++) {
+			float f = (float)i;
+			verts.push_back(f, f, f, 0, 0, 1, f, f);
+		}
+		doNotOptimize(verts.data<0>());
+	});
+	measure(suite, "vertex_push_back", "std_aos", 1, numVerts, [&]() {
+		std::vector<Vertex> verts;
+		for (size_t i = 0; i < numVerts; i++) {
+			float f = (float)i;
+			verts.push_back(Vertex{ { f, f, f }, { 0, 0, 1 }, { f, f } });
+		}
+		doNotOptimize(verts.data());
+	});
+}
+
+vector<int> randomKeys(size_t num, uint64_t seed)
+{
+	Lcg rand(seed);
+	vector<int> keys(num);
+	for (auto& key : keys)
+		key = (int)(rand() & 0x7fffffff);
+	return keys;
+}
+
+void benchSet()
+{
+	const string suite = "set";
+
+	MultiCore::local_heap heap(256);
+	MultiCore::scoped_set_local_heap heapSetter(&heap);
+
+	// Single inserts into the sorted vector are O(n), keep this size moderate
+	size_t numSingle = scaled(20000);
+	auto keys = randomKeys(numSingle, 1);
+	measure(suite, "insert_single", "MultiCore", 1, numSingle, [&]() {
+		MultiCore::set<int> s;
+		for (int key : keys)
+			s.insert(key);
+		doNotOptimize(s.size());
+	});
+	measure(suite, "insert_single", "std", 1, numSingle, [&]() {
+		std::set<int> s;
+		for (int key : keys)
+			s.insert(key);
+		doNotOptimize(s.size());
+	});
+
+	size_t numBatch = scaled(1000000);
+	auto batchKeys = randomKeys(numBatch, 2);
+	measure(suite, "insert_batch", "MultiCore", 1, numBatch, [&]() {
+		MultiCore::set<int> s;
+		s.insert(batchKeys.begin(), batchKeys.end());
+		doNotOptimize(s.size());
+	});
+	measure(suite, "insert_batch", "std", 1, numBatch, [&]() {
+		std::set<int> s(batchKeys.begin(), batchKeys.end());
+		doNotOptimize(s.size());
+	});
+
+	MultiCore::set<int> poolSet;
+	poolSet.insert(batchKeys.begin(), batchKeys.end());
+	std::set<int> stdSet(batchKeys.begin(), batchKeys.end());
+
+	// Half hits, half misses, as in the map benchmark
+	auto misses = randomKeys(numBatch / 2, 6);
+	vector<int> lookups;
+	for (size_t i = 0; i < numBatch; i++)
+		lookups.push_back(i % 2 == 0 ? batchKeys[numBatch - 1 - i / 2] : misses[i / 2]);
+	measure(suite, "find", "MultiCore", 1, numBatch, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += poolSet.contains(key) ? 1 : 0;
+		doNotOptimize(found);
+	});
+	measure(suite, "find", "std", 1, numBatch, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += stdSet.count(key);
+		doNotOptimize(found);
+	});
+}
+
+void benchMaps()
+{
+	const string suite = "map";
+
+	MultiCore::local_heap heap(256);
+	MultiCore::scoped_set_local_heap heapSetter(&heap);
+
+	size_t numSingle = scaled(20000);
+	auto keys = randomKeys(numSingle, 3);
+	measure(suite, "insert", "MultiCore::map", 1, numSingle, [&]() {
+		MultiCore::map<int, int> m;
+		for (int key : keys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+	measure(suite, "insert", "MultiCore::unordered_map", 1, numSingle, [&]() {
+		MultiCore::unordered_map<int, int> m;
+		for (int key : keys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+	measure(suite, "insert", "std::map", 1, numSingle, [&]() {
+		std::map<int, int> m;
+		for (int key : keys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+	measure(suite, "insert", "std::unordered_map", 1, numSingle, [&]() {
+		std::unordered_map<int, int> m;
+		for (int key : keys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+
+	size_t numLarge = scaled(1000000);
+	auto largeKeys = randomKeys(numLarge, 4);
+	measure(suite, "insert_large", "MultiCore::unordered_map", 1, numLarge, [&]() {
+		MultiCore::unordered_map<int, int> m;
+		for (int key : largeKeys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+	measure(suite, "insert_large", "std::unordered_map", 1, numLarge, [&]() {
+		std::unordered_map<int, int> m;
+		for (int key : largeKeys)
+			m.insert(make_pair(key, key));
+		doNotOptimize(m.size());
+	});
+
+	MultiCore::map<int, int> poolMap;
+	std::map<int, int> stdMap;
+	MultiCore::unordered_map<int, int> poolHash;
+	std::unordered_map<int, int> stdHash;
+	for (int key : keys) {
+		poolMap.insert(make_pair(key, key));
+		stdMap.insert(make_pair(key, key));
+		poolHash.insert(make_pair(key, key));
+		stdHash.insert(make_pair(key, key));
+	}
+
+	// Half hits, half misses
+	size_t numLookups = scaled(1000000);
+	auto misses = randomKeys(numLookups / 2, 5);
+	vector<int> lookups;
+	for (size_t i = 0; i < numLookups; i++)
+		lookups.push_back(i % 2 == 0 ? keys[(i / 2) % keys.size()] : misses[i / 2]);
+
+	measure(suite, "find", "MultiCore::map", 1, numLookups, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += poolMap.count(key);
+		doNotOptimize(found);
+	});
+	measure(suite, "find", "MultiCore::unordered_map", 1, numLookups, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += poolHash.count(key);
+		doNotOptimize(found);
+	});
+	measure(suite, "find", "std::map", 1, numLookups, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += stdMap.count(key);
+		doNotOptimize(found);
+	});
+	measure(suite, "find", "std::unordered_map", 1, numLookups, [&]() {
+		size_t found = 0;
+		for (int key : lookups)
+			found += stdHash.count(key);
+		doNotOptimize(found);
+	});
+}
+
+void benchConcurrentMap()
+{
+	const string suite = "concurrent_map";
+
+	size_t numKeys = 65536;
+	auto keys = randomKeys(numKeys, 6);
+
+	MultiCore::concurrent_map<int, int> cmap;
+	vector<pair<int, int>> pairs;
+	for (int key : keys)
+		pairs.push_back(make_pair(key, key));
+	cmap.insert(pairs.begin(), pairs.end());
+
+	std::unordered_map<int, int> lockedMap(pairs.begin(), pairs.end());
+	shared_mutex lockedMapMutex;
+
+	size_t lookupsPerThread = scaled(1000000);
+	for (size_t numThreads : threadCounts(64)) {
+		measure(suite, "read_scaling", "concurrent_map", numThreads, lookupsPerThread * numThreads, [&]() {
+			runThreads(numThreads, [&](size_t threadNum) {
+				Lcg rand(threadNum + 1);
+				size_t found = 0;
+				for (size_t i = 0; i < lookupsPerThread; i++)
+					found += cmap.contains(keys[rand() % numKeys]) ? 1 : 0;
+				doNotOptimize(found);
+			});
+		});
+
+		measure(suite, "read_scaling", "shared_mutex", numThreads, lookupsPerThread * numThreads, [&]() {
+			runThreads(numThreads, [&](size_t threadNum) {
+				Lcg rand(threadNum + 1);
+				size_t found = 0;
+				for (size_t i = 0; i < lookupsPerThread; i++) {
+					shared_lock lock(lockedMapMutex);
+					found += lockedMap.count(keys[rand() % numKeys]);
+				}
+				doNotOptimize(found);
+			});
+		});
+	}
+}
+
+// Same size as a small mesh record
+struct PoolNode {
+	int _vals[12];
+};
+
+template<class CREATE, class DESTROY>
+void objectChurn(size_t numOps, CREATE createFunc, DESTROY destroyFunc)
+{
+	using Ptr = decltype(createFunc(0));
+
+	const size_t numSlots = 1024;
+	vector<Ptr> slots(numSlots);
+
+	Lcg rand;
+	for (size_t i = 0; i < numOps; i++) {
+		auto& slot = slots[rand() % numSlots];
+		if (slot)
+			destroyFunc(slot);
+		slot = createFunc((int)i);
+	}
+
+	for (auto& slot : slots) {
+		if (slot)
+			destroyFunc(slot);
+	}
+}
+
+void benchObjectPool()
+{
+	const string suite = "object_pool";
+
+	size_t numOps = scaled(2000000);
+	MultiCore::object_pool<PoolNode> pool;
+	using Handle = MultiCore::object_pool<PoolNode>::handle;
+
+	measure(suite, "churn", "object_pool", 1, numOps, [&]() {
+		objectChurn(numOps, [&](int val) {
+			return pool.create(PoolNode{ { val } });
+		}, [&](PoolNode*& p) {
+			pool.destroy(p);
+			p = nullptr;
+		});
+	});
+	measure(suite, "churn", "object_pool_handle", 1, numOps, [&]() {
+		objectChurn(numOps, [&](int val) {
+			return pool.make_handle(PoolNode{ { val } });
+		}, [&](Handle& h) {
+			h.reset();
+		});
+	});
+	measure(suite, "churn", "new_delete", 1, numOps, [&]() {
+		objectChurn(numOps, [&](int val) {
+			return new PoolNode{ { val } };
+		}, [&](PoolNode*& p) {
+			delete p;
+			p = nullptr;
+		});
+	});
+	measure(suite, "churn", "make_shared", 1, numOps, [&]() {
+		objectChurn(numOps, [&](int val) {
+			return make_shared<PoolNode>(PoolNode{ { val } });
+		}, [&](shared_ptr<PoolNode>& p) {
+			p.reset();
+		});
+	});
+
+	size_t numCores = MultiCore::getNumCores();
+	size_t opsPerThread = numOps / numCores + 1;
+	measure(suite, "churn_threaded", "object_pool_handle", numCores, opsPerThread * numCores, [&]() {
+		runThreads(numCores, [&](size_t) {
+			objectChurn(opsPerThread, [&](int val) {
+				return pool.make_handle(PoolNode{ { val } });
+			}, [&](Handle& h) {
+				h.reset();
+			});
+
+			// The worker exits after this, leave its cached nodes for the next iteration's threads
+			pool.flushThreadCache();
+		});
+	});
+	measure(suite, "churn_threaded", "make_shared", numCores, opsPerThread * numCores, [&]() {
+		runThreads(numCores, [&](size_t) {
+			objectChurn(opsPerThread, [&](int val) {
+				return make_shared<PoolNode>(PoolNode{ { val } });
+			}, [&](shared_ptr<PoolNode>& p) {
+				p.reset();
+			});
+		});
+	});
+}
+
+void writeJson(ostream& out)
+{
+	out << "{\n";
+	out << "  \"context\": { \"hardware_concurrency\": " << MultiCore::getNumCores()
+		<< ", \"reps\": " << g_options._reps << ", \"quick\": " << (g_options._quick ? "true" : "false") << " },\n";
+	out << "  \"benchmarks\": [\n";
+	for (size_t i = 0; i < g_results.size(); i++) {
+		const auto& res = g_results[i];
+		char buf[512];
+		snprintf(buf, sizeof(buf),
+			"    { \"suite\": \"%s\", \"name\": \"%s\", \"variant\": \"%s\", \"threads\": %zu, \"ops\": %zu, \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f }%s\n",
+			res._suite.c_str(), res._name.c_str(), res._variant.c_str(), res._threads, res._ops, res._nsPerOp, res._minNsPerOp,
+			i + 1 < g_results.size() ? "," : "");
+		out << buf;
+	}
+	out << "  ]\n";
+	out << "}\n";
+}
+
+void writeCsv(ostream& out)
+{
+	out << "suite,name,variant,threads,ops,ns_per_op,min_ns_per_op\n";
+	for (const auto& res : g_results) {
+		char buf[512];
+		snprintf(buf, sizeof(buf), "%s,%s,%s,%zu,%zu,%.3f,%.3f\n",
+			res._suite.c_str(), res._name.c_str(), res._variant.c_str(), res._threads, res._ops, res._nsPerOp, res._minNsPerOp);
+		out << buf;
+	}
+}
+
+bool parseArgs(int argc, char** argv)
+{
+	for (int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "--quick")
+			g_options._quick = true;
+		else if (arg == "--reps" && hasValue)
+			g_options._reps = max<size_t>(strtoul(argv[++i], nullptr, 10), 1);
+		else if (arg == "--filter" && hasValue)
+			g_options._filter = argv[++i];
+		else if (arg == "--format" && hasValue)
+			g_options._format = argv[++i];
+		else if (arg == "--out" && hasValue)
+			g_options._outPath = argv[++i];
+		else
+			return false;
+	}
+
+	return g_options._format == "json" || g_options._format == "csv";
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	if (!parseArgs(argc, argv)) {
+		fprintf(stderr, "usage: %s [--quick] [--reps N] [--filter text] [--format json|csv] [--out file]\n", argv[0]);
+		return 1;
+	}
+
+	benchThreadPool();
+	benchRunLambda();
+	benchLocalHeap();
+	benchVector();
+	benchSet();
+	benchMaps();
+	benchConcurrentMap();
+	benchObjectPool();
+
+	ofstream outFile;
+	if (!g_options._outPath.empty()) {
+		outFile.open(g_options._outPath);
+		if (!outFile) {
+			fprintf(stderr, "Could not open %s\n", g_options._outPath.c_str());
+			return 1;
+		}
+	}
+	ostream& out = outFile.is_open() ? outFile : cout;
+
+	if (g_options._format == "csv")
+		writeCsv(out);
+	else
+		writeJson(out);
+
+	return 0;
+}
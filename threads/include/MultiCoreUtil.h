@@ -51,6 +51,10 @@
 #include <thread>
 #include <condition_variable>
 #include <functional>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
 
 namespace MultiCore {
 
@@ -156,6 +160,41 @@ namespace MultiCore {
 		}
 	}
 
+/*
+	How ThreadPool::run assigns indices to threads.
+
+	SCHEDULE_STRIDED	Thread t runs t, t + numThreads, ... This is the default.
+	SCHEDULE_SHUFFLE	The indices are shuffled and dealt out round robin. Each run uses a new seed, derived from the
+						pool's seed and the run count, so a sequence of runs is repeatable.
+	SCHEDULE_REPLAY		Each thread runs the indices it ran in a recorded schedule, in the recorded order.
+
+	Recording is independent of the mode, so a shuffled run can be recorded and then replayed.
+	These only apply to multi core runs.
+*/
+enum ScheduleMode {
+	SCHEDULE_STRIDED,
+	SCHEDULE_SHUFFLE,
+	SCHEDULE_REPLAY,
+};
+
+// One call of the function. Times are nanoseconds from the start of the run.
+struct ScheduleStep {
+	size_t _threadNum;
+	size_t _idx;
+	uint64_t _startNs, _stopNs;
+};
+
+// One call to ThreadPool::run, ordered by start time
+struct Schedule {
+	size_t _numSteps = 0;
+	size_t _numThreads = 0;
+	_STD vector<ScheduleStep> _steps;
+};
+
+// Plain text, one "run numSteps numThreads numEntries" line per schedule followed by "threadNum idx startNs stopNs" lines
+void writeSchedules(_STD ostream& out, const _STD vector<Schedule>& schedules);
+bool readSchedules(_STD istream& in, _STD vector<Schedule>& schedules);
+
 class ThreadPool {
 private:
 	enum Stage {
@@ -173,6 +212,17 @@ public:
 
 	inline size_t getNumThreads() const;
 
+	// Call these between runs, from the thread which calls run. Changing the mode or replay schedules restarts the run count.
+	void setScheduleMode(ScheduleMode mode, uint64_t seed = 0);
+	ScheduleMode getScheduleMode() const;
+
+	// Run n of replay mode uses schedules[n]. A run with no schedule, or one which doesn't match the run, is strided.
+	void setReplaySchedules(const _STD vector<Schedule>& schedules);
+
+	void setRecording(bool record);
+	const _STD vector<Schedule>& getRecordedSchedules() const;
+	void clearRecordedSchedules();
+
 	template<class L>
 	inline void run(size_t numSteps, const L& f, bool multiCore);
 	template<class L>
@@ -192,15 +242,32 @@ private:
 	void setStage(Stage st, size_t threadNum) const;
 
 	void runFunc_private(size_t numSteps, FuncType* f) const;
+	bool buildThreadIndices(size_t numSteps) const;
+	void finishRecording(size_t numSteps) const;
 
 	static void runStat(ThreadPool* pSelf, size_t threadNum);
 
 	void run(size_t threadNum);
+	void runSteps(size_t threadNum);
 
-	bool _running = true;
+	_STD atomic<bool> _running = true;
 	mutable size_t _numSteps = 0;
 	const size_t _numThreads;
 
+	ScheduleMode _scheduleMode = SCHEDULE_STRIDED;
+	uint64_t _seed = 0;
+	bool _recording = false;
+	mutable size_t _runCount = 0;
+	_STD vector<Schedule> _replaySchedules;
+	mutable _STD vector<Schedule> _recordedSchedules;
+
+	// Per run state, set by the primary thread while the workers are stopped
+	mutable bool _useThreadIndices = false;
+	mutable bool _recordRun = false;
+	mutable _STD chrono::steady_clock::time_point _runStart;
+	mutable _STD vector<_STD vector<size_t>> _threadIndices;
+	mutable _STD vector<_STD vector<ScheduleStep>> _threadSteps;
+
 	mutable FuncType* _pFunc = nullptr;
 
 	mutable _STD condition_variable _cv;
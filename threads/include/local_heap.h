@@ -88,6 +88,20 @@ public:
 	template<class T>
 	void free(T*& ptr);
 
+	// Grows the allocation at ptr to hold num objects without moving it. This succeeds if the block is the last one
+	// carved from the top block and there's room behind it, or if the chunks right after it are on the avail list.
+	// New objects are default constructed, same as alloc. Returns false if the block could not be grown in place.
+	template<class T>
+	bool tryExpand(T* ptr, size_t num);
+
+	// Uninitialized storage for containers which track construction themselves. Nothing is constructed, and free
+	// releases the memory without destroying anything.
+	template<class T>
+	T* allocRaw(size_t num);
+
+	template<class T>
+	bool tryExpandRaw(T* ptr, size_t num);
+
 #if GUARD_BAND_SIZE > 0
 	struct GuardBand {
 		size_t _b0[GUARD_BAND_SIZE];
@@ -173,10 +187,14 @@ private:
 	template<class P>
 	void freeMem(P*& ptr);
 
+	bool expandMem(void* ptr, size_t numBytes);
+	size_t getBlockSizeChunks(size_t blockIdx) const;
+
 	BlockHeader* getAvailBlock(size_t numChunksNeeded);
 	void addBlockToAvailList(const BlockHeader& header);
 	void insertAvailBlock(AvailBlockHeader*& pFirstAvailBlock, AvailBlockHeader* pPriorBlock, AvailBlockHeader* pCurBlock, AvailBlockHeader* pAvailBlock);
 	void removeAvailBlock(AvailBlockHeader*& pFirstAvailBlock, AvailBlockHeader* pPriorBlock, AvailBlockHeader* pRecycledBlock);
+	bool removeIfAvail(AvailBlockHeader* pBlock);
 
 	bool isHeaderValid(const void* p, bool pointsToHeader) const;
 	bool verifyAvailList() const;
@@ -236,6 +254,55 @@ void local_heap::free(T*& ptr)
 	}
 }
 
+template<class T>
+bool local_heap::tryExpand(T* ptr, size_t num)
+{
+	if (!ptr)
+		return false;
+
+	char* pc = (char*)ptr;
+	BlockHeader* pHeader = (BlockHeader*)(pc - sizeof(BlockHeader));
+#if GUARD_BAND_SIZE > 0
+	assert(pHeader->_leadingBand.isValid());
+#endif
+	size_t oldNum = pHeader->_numObj;
+	if (num <= oldNum)
+		return true;
+
+	if (!expandMem(ptr, num * sizeof(T)))
+		return false;
+
+	for (size_t i = oldNum; i < num; i++) {
+		T* px = new(&ptr[i]) T(); // default in place constructor
+	}
+	pHeader->_numObj = (uint32_t)num;
+
+	return true;
+}
+
+template<class T>
+T* local_heap::allocRaw(size_t num)
+{
+	char* pc = (char*)allocMem(num * sizeof(T));
+
+	BlockHeader* pHeader = (BlockHeader*)(pc - sizeof(BlockHeader));
+	pHeader->_numObj = 0;
+
+#if GUARD_BAND_SIZE > 0
+	assert(pHeader->_leadingBand.isValid());
+#endif
+	return (T*)pc;
+}
+
+template<class T>
+bool local_heap::tryExpandRaw(T* ptr, size_t num)
+{
+	if (!ptr)
+		return false;
+
+	return expandMem(ptr, num * sizeof(T));
+}
+
 template<class P>
 void ::MultiCore::local_heap::freeMem(P*& ptr)
 {
@@ -266,6 +333,36 @@ protected:
 		getHeap()->free(ptr);
 	}
 
+	template<class T>
+	bool tryExpand(T* ptr, size_t num) const
+	{
+		return getHeap()->tryExpand(ptr, num);
+	}
+
+	template<class T>
+	T* allocRaw(size_t num) const
+	{
+		return getHeap()->allocRaw<T>(num);
+	}
+
+	template<class T>
+	bool tryExpandRaw(T* ptr, size_t num) const
+	{
+		return getHeap()->tryExpandRaw(ptr, num);
+	}
+
+	// Memory can only change owners between users of the same heap. Move operations use these to decide
+	// if they can steal the storage.
+	bool isSameHeap(const local_heap_user& other) const
+	{
+		return getHeap() == other.getHeap();
+	}
+
+	void useHeapOf(const local_heap_user& other)
+	{
+		_pOurHeap = other.getHeap();
+	}
+
 private:
 	local_heap* getHeap() const;
 
@@ -0,0 +1,104 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <local_heap.h>
+#include <pool_unordered_map.h>
+
+namespace MultiCore
+{
+
+/*
+	Read mostly map for lookup tables shared by ThreadPool workers.
+
+	Keys are split over NUM_SHARDS shards. Each shard publishes an immutable snapshot, a MultiCore::unordered_map built in the
+	snapshot's own local_heap, through an atomic pointer. Readers load the pointer and probe the table, they never lock,
+	never write shared memory and never wait.
+
+	Writers lock only the shards they touch, copy the current snapshot, apply their changes and publish the copy. The old
+	snapshot is retired, not freed, because a reader may still be using it. Call reclaim() when no reader can be running,
+	for example after ThreadPool::run returns, to free retired snapshots. Pointers returned by findPtr are valid until then.
+
+	Every write copies a whole shard, so batch updates with insert(begin, end) when possible.
+*/
+template<class KEY, class T, class HASH = std::hash<KEY>, class EQ = std::equal_to<KEY>, size_t NUM_SHARDS = 16>
+class concurrent_map {
+public:
+	using DataPair = std::pair<KEY, T>;
+
+	concurrent_map() = default;
+	concurrent_map(const concurrent_map& src) = delete;
+	~concurrent_map();
+
+	concurrent_map& operator = (const concurrent_map& rhs) = delete;
+
+	// Readers. Wait free, safe from any thread.
+	bool find(const KEY& key, T& value) const;
+	const T* findPtr(const KEY& key) const;
+	bool contains(const KEY& key) const;
+	size_t size() const;
+	bool empty() const;
+
+	// Writers. Serialized per shard.
+	bool insert(const DataPair& pair);
+	template<class ITER_TYPE>
+	void insert(const ITER_TYPE& begin, const ITER_TYPE& end);
+	void insert_or_assign(const KEY& key, const T& value);
+	size_t erase(const KEY& key);
+	void clear();
+
+	// Frees retired snapshots. The caller must guarantee no reader is using them.
+	void reclaim();
+
+private:
+	using DataMap = MultiCore::unordered_map<KEY, T, HASH, EQ>;
+
+	struct Snapshot {
+		Snapshot(const Snapshot* pPrior, size_t numToAdd);
+
+		local_heap _heap;	// Must be declared before _map, _map is freed into it
+		DataMap _map;
+	};
+
+	struct alignas(64) Shard {
+		_STD atomic<Snapshot*> _pCurrent = nullptr;
+		_STD mutex _writeMutex;
+		_STD vector<Snapshot*> _retired;
+	};
+
+	static size_t shardOf(const KEY& key);
+	void publish(Shard& shard, Snapshot* pSnapshot);
+
+	Shard _shards[NUM_SHARDS];
+};
+
+}
+
+#include <pool_concurrent_map.hpp>
@@ -0,0 +1,229 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <pool_concurrent_map.h>
+
+#define TEMPL_DECL template<class KEY, class T, class HASH, class EQ, size_t NUM_SHARDS>
+#define MAP_DECL MultiCore::concurrent_map<KEY, T, HASH, EQ, NUM_SHARDS>
+
+namespace MultiCore {
+
+TEMPL_DECL
+MAP_DECL::Snapshot::Snapshot(const Snapshot* pPrior, size_t numToAdd)
+	: _heap(1) // The table is one large allocation and gets its own block, keep the default block small
+{
+	scoped_set_local_heap sh(&_heap);
+	_map.reserve((pPrior ? pPrior->_map.size() : 0) + numToAdd);
+	if (pPrior) {
+		for (const auto& pair : pPrior->_map)
+			_map.insert(pair);
+	}
+}
+
+TEMPL_DECL
+MAP_DECL::~concurrent_map()
+{
+	for (auto& shard : _shards) {
+		delete shard._pCurrent.load();
+		for (auto pSnapshot : shard._retired)
+			delete pSnapshot;
+	}
+}
+
+TEMPL_DECL
+bool MAP_DECL::find(const KEY& key, T& value) const
+{
+	const T* p = findPtr(key);
+	if (p) {
+		value = *p;
+		return true;
+	}
+	return false;
+}
+
+TEMPL_DECL
+const T* MAP_DECL::findPtr(const KEY& key) const
+{
+	const Snapshot* pSnapshot = _shards[shardOf(key)]._pCurrent.load(_STD memory_order_acquire);
+	if (pSnapshot) {
+		auto iter = pSnapshot->_map.find(key);
+		if (iter != pSnapshot->_map.end())
+			return &iter->second;
+	}
+	return nullptr;
+}
+
+TEMPL_DECL
+inline bool MAP_DECL::contains(const KEY& key) const
+{
+	return findPtr(key) != nullptr;
+}
+
+TEMPL_DECL
+size_t MAP_DECL::size() const
+{
+	// Each shard is exact, the sum is only a snapshot if writers are active
+	size_t result = 0;
+	for (const auto& shard : _shards) {
+		const Snapshot* pSnapshot = shard._pCurrent.load(_STD memory_order_acquire);
+		if (pSnapshot)
+			result += pSnapshot->_map.size();
+	}
+	return result;
+}
+
+TEMPL_DECL
+inline bool MAP_DECL::empty() const
+{
+	return size() == 0;
+}
+
+TEMPL_DECL
+bool MAP_DECL::insert(const DataPair& pair)
+{
+	Shard& shard = _shards[shardOf(pair.first)];
+	_STD lock_guard lk(shard._writeMutex);
+
+	const Snapshot* pPrior = shard._pCurrent.load(_STD memory_order_relaxed);
+	if (pPrior && pPrior->_map.contains(pair.first))
+		return false;
+
+	Snapshot* pSnapshot = new Snapshot(pPrior, 1);
+	{
+		scoped_set_local_heap sh(&pSnapshot->_heap);
+		pSnapshot->_map.insert(pair);
+	}
+	publish(shard, pSnapshot);
+
+	return true;
+}
+
+TEMPL_DECL
+template<class ITER_TYPE>
+void MAP_DECL::insert(const ITER_TYPE& begin, const ITER_TYPE& end)
+{
+	// One new snapshot per touched shard, not one per entry
+	size_t numPerShard[NUM_SHARDS] = {};
+	for (auto iter = begin; iter != end; iter++)
+		numPerShard[shardOf(iter->first)]++;
+
+	for (size_t i = 0; i < NUM_SHARDS; i++) {
+		if (numPerShard[i] == 0)
+			continue;
+
+		Shard& shard = _shards[i];
+		_STD lock_guard lk(shard._writeMutex);
+
+		Snapshot* pSnapshot = new Snapshot(shard._pCurrent.load(_STD memory_order_relaxed), numPerShard[i]);
+		{
+			scoped_set_local_heap sh(&pSnapshot->_heap);
+			for (auto iter = begin; iter != end; iter++) {
+				if (shardOf(iter->first) == i)
+					pSnapshot->_map.insert(DataPair(iter->first, iter->second));
+			}
+		}
+		publish(shard, pSnapshot);
+	}
+}
+
+TEMPL_DECL
+void MAP_DECL::insert_or_assign(const KEY& key, const T& value)
+{
+	Shard& shard = _shards[shardOf(key)];
+	_STD lock_guard lk(shard._writeMutex);
+
+	Snapshot* pSnapshot = new Snapshot(shard._pCurrent.load(_STD memory_order_relaxed), 1);
+	{
+		scoped_set_local_heap sh(&pSnapshot->_heap);
+		pSnapshot->_map[key] = value;
+	}
+	publish(shard, pSnapshot);
+}
+
+TEMPL_DECL
+size_t MAP_DECL::erase(const KEY& key)
+{
+	Shard& shard = _shards[shardOf(key)];
+	_STD lock_guard lk(shard._writeMutex);
+
+	const Snapshot* pPrior = shard._pCurrent.load(_STD memory_order_relaxed);
+	if (!pPrior || !pPrior->_map.contains(key))
+		return 0;
+
+	Snapshot* pSnapshot = new Snapshot(pPrior, 0);
+	{
+		scoped_set_local_heap sh(&pSnapshot->_heap);
+		pSnapshot->_map.erase(key);
+	}
+	publish(shard, pSnapshot);
+
+	return 1;
+}
+
+TEMPL_DECL
+void MAP_DECL::clear()
+{
+	for (auto& shard : _shards) {
+		_STD lock_guard lk(shard._writeMutex);
+		if (shard._pCurrent.load(_STD memory_order_relaxed))
+			publish(shard, nullptr);
+	}
+}
+
+TEMPL_DECL
+void MAP_DECL::reclaim()
+{
+	for (auto& shard : _shards) {
+		_STD lock_guard lk(shard._writeMutex);
+		for (auto pSnapshot : shard._retired)
+			delete pSnapshot;
+		shard._retired.clear();
+	}
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::shardOf(const KEY& key)
+{
+	// Use the high bits, the table inside the shard uses the low ones
+	uint64_t h = (uint64_t)HASH()(key) * 0xC2B2AE3D27D4EB4Full;
+	return (size_t)(h >> 40) % NUM_SHARDS;
+}
+
+TEMPL_DECL
+void MAP_DECL::publish(Shard& shard, Snapshot* pSnapshot)
+{
+	// Caller holds the shard's write mutex
+	Snapshot* pPrior = shard._pCurrent.exchange(pSnapshot, _STD memory_order_acq_rel);
+	if (pPrior)
+		shard._retired.push_back(pPrior);
+}
+
+}
+
+#undef TEMPL_DECL
+#undef MAP_DECL
@@ -26,6 +26,7 @@ This file is part of the DistFieldHexMesh application/library.
 	Dark Sky Innovative Solutions http://darkskyinnovation.com/
 */
 
+#include <cstdint>
 #include <map>
 #include <pool_vector.h>
 #include <pool_set.h>
@@ -36,6 +37,12 @@ This file is part of the DistFieldHexMesh application/library.
 #define REV 3
 #define IS_CONST (IterType < FORW)
 
+// Key records hold the key and a 32 bit index into the data array. For an int key that's 8 bytes instead of 24, so three times as
+// many keys fit in cache during the binary search. Set to 0 for the original records with a pointer back to the data array.
+#ifndef POOL_MAP_COMPACT_KEY_REC
+#define POOL_MAP_COMPACT_KEY_REC 1
+#endif
+
 namespace MultiCore
 {
 
@@ -78,6 +85,17 @@ public:
 	using DataMap = MultiCore::map<KEY, T>;
 	using DataVec = ::MultiCore::vector<DataPair>;
 
+#if POOL_MAP_COMPACT_KEY_REC
+	struct KeyRec
+	{
+		KeyRec(const KeyRec& src) = default;
+		KeyRec(const KEY& key = KEY(), uint32_t idx = UINT32_MAX);
+		bool operator < (const KeyRec& rhs) const;
+
+		KEY _key;
+		uint32_t _idx = UINT32_MAX;	// Index into the owning map's _data
+	};
+#else
 	struct KeyRec
 	{
 		KeyRec(const KeyRec& src) = default;
@@ -88,6 +106,7 @@ public:
 		size_t _idx = -1;
 		DataVec* _pVec = nullptr;
 	};
+#endif
 
 	using KeySet = ::MultiCore::set<KeyRec>;
 	using KeyIndexVec = ::MultiCore::vector<size_t>;
@@ -150,6 +169,9 @@ public:
 
 	map() = default;
 	map(const map& src) = default;
+#if POOL_MAP_COMPACT_KEY_REC
+	map(map&& src) = default;
+#endif
 	~map() = default;
 
 	bool empty() const;
@@ -168,7 +190,10 @@ public:
 	const T& operator[](const KEY& key) const;
 	T& operator[](const KEY& key);
 
-	map& operator = (const map& rhs);
+	map& operator = (const map& rhs) = default;
+#if POOL_MAP_COMPACT_KEY_REC
+	map& operator = (map&& rhs) = default;
+#endif
 	bool contains(const KEY& val) const;
 
 	iterator begin() noexcept;
@@ -26,6 +26,7 @@ This file is part of the DistFieldHexMesh application/library.
 	Dark Sky Innovative Solutions http://darkskyinnovation.com/
 */
 
+#include <assert.h>
 #include <local_heap.h>
 #include <pool_map.h>
 
@@ -42,7 +43,12 @@ std::pair<typename MAP_DECL::iterator, bool> MAP_DECL::insert(const DataPair& pa
 		auto* pPair = allocEntry(pair);
 		size_t idx = (size_t)(pPair - _data.data());
 
+#if POOL_MAP_COMPACT_KEY_REC
+		assert(idx < UINT32_MAX);
+		KeyRec rec(pair.first, (uint32_t)idx);
+#else
 		KeyRec rec(pair.first, &_data, idx);
+#endif
 
 		keyIter = _keySet.insert(rec);
 
@@ -98,6 +104,7 @@ void MAP_DECL::clear()
 {
 	_keySet.clear();
 	_data.clear();
+	_availEntries.clear();
 }
 
 TEMPL_DECL
@@ -355,11 +362,17 @@ ITER_TEMPL_DECL
 inline const typename MAP_DECL::DataPair* ITER_DECL::get() const
 {
 	const KeyRec& key = *_keyIter;
+#if POOL_MAP_COMPACT_KEY_REC
+	if (key._idx < _pSource->_data.size())
+		return &_pSource->_data[key._idx];
+	return nullptr;
+#else
 	if (key._pVec && key._idx < key._pVec->size()) {
 		auto& arr = *key._pVec;
 		return &arr[key._idx];
 	}
 	return nullptr;
+#endif
 }
 
 TEMPL_DECL
@@ -367,13 +380,36 @@ ITER_TEMPL_DECL
 inline typename MAP_DECL::DataPair* ITER_DECL::get()
 {
 	const KeyRec& key = *_keyIter;
+#if POOL_MAP_COMPACT_KEY_REC
+	if (key._idx < _pSource->_data.size())
+		return const_cast<DataPair*>(&_pSource->_data[key._idx]);
+	return nullptr;
+#else
 	if (key._pVec && key._idx < key._pVec->size()) {
 		auto& arr = *key._pVec;
 		return &arr[key._idx];
 	}
 	return nullptr;
+#endif
+}
+
+#if POOL_MAP_COMPACT_KEY_REC
+
+TEMPL_DECL
+inline MAP_DECL::KeyRec::KeyRec(const KEY& key, uint32_t idx)
+	: _key(key)
+	, _idx(idx)
+{
 }
 
+TEMPL_DECL
+inline bool MAP_DECL::KeyRec::operator < (const KeyRec& rhs) const
+{
+	return _key < rhs._key;
+}
+
+#else
+
 TEMPL_DECL
 inline MAP_DECL::KeyRec::KeyRec(const KEY& key, DataVec* pVec, size_t idx)
 	: _key(key)
@@ -395,5 +431,9 @@ inline bool MAP_DECL::KeyRec::operator < (const KeyRec& rhs) const
 	return _key < rhs._key;
 }
 
+#endif
+
 #undef TEMPL_DECL 
+#undef ITER_TEMPL_DECL 
 #undef MAP_DECL 
+#undef ITER_DECL 
@@ -0,0 +1,158 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MultiCore
+{
+
+/*
+	Fixed size object pool for node types which are created and destroyed at high rates by many threads.
+
+	Each thread gets a magazine, a private freelist threaded through the free nodes themselves. create and destroy only
+	touch the calling thread's magazine. When a magazine runs dry it takes a whole chain of MAGAZINE_SIZE nodes from the
+	shared depot, and when it holds 2 * MAGAZINE_SIZE nodes it returns a chain, so the depot mutex is taken once per
+	MAGAZINE_SIZE operations at most. The depot carves new chains from slabs of SLAB_SIZE nodes.
+
+	Nodes may be destroyed on a different thread than the one which created them. Memory is only released when the pool
+	is destroyed, all objects must be destroyed by then. A thread's cached nodes stay with the pool when the thread exits,
+	call flushThreadCache first to make them available to other threads. Other threads' cache entries for a destroyed pool
+	are pruned the next time they look up a pool they haven't used last.
+
+	handle is an intrusive reference counted pointer. The count lives in the node, there's no control block.
+*/
+template<class T, size_t MAGAZINE_SIZE = 64, size_t SLAB_SIZE = 1024>
+class object_pool {
+	struct Node;
+public:
+	static_assert(MAGAZINE_SIZE > 0 && SLAB_SIZE % MAGAZINE_SIZE == 0, "SLAB_SIZE must be a multiple of MAGAZINE_SIZE");
+
+	class handle {
+	public:
+		handle() = default;
+		handle(const handle& src);
+		handle(handle&& src) noexcept;
+		~handle();
+
+		handle& operator = (const handle& rhs);
+		handle& operator = (handle&& rhs) noexcept;
+
+		T* get() const;
+		T& operator *() const;
+		T* operator ->() const;
+		explicit operator bool() const;
+		uint32_t use_count() const;
+		void reset();
+
+	private:
+		friend class object_pool;
+		handle(object_pool* pPool, Node* pNode);
+
+		object_pool* _pPool = nullptr;
+		Node* _pNode = nullptr;
+	};
+
+	object_pool();
+	object_pool(const object_pool& src) = delete;
+	~object_pool();
+
+	object_pool& operator = (const object_pool& rhs) = delete;
+
+	template<class... ARGS>
+	T* create(ARGS&&... args);
+	void destroy(T* p);
+
+	template<class... ARGS>
+	handle make_handle(ARGS&&... args);
+
+	void flushThreadCache();
+	size_t numSlabs() const;
+
+private:
+	struct Node {
+		union {
+			Node* _pNext;
+			alignas(T) char _obj[sizeof(T)];
+		};
+		std::atomic<uint32_t> _refs;
+	};
+
+	struct Magazine {
+		Node* _pHead = nullptr;
+		size_t _count = 0;
+	};
+
+	struct Chain {
+		Node* _pHead;
+		size_t _count;
+	};
+
+	struct LastEntry {
+		uint64_t _poolId;
+		Magazine* _pMagazine;
+	};
+
+	struct CacheEntry {
+		uint64_t _poolId;
+		Magazine* _pMagazine;
+		std::weak_ptr<void> _poolLifetime; // Expires with the pool
+	};
+
+	Magazine* getMagazine();
+	Magazine* findMagazine();
+	Node* allocNode();
+	void freeNode(Node* pNode);
+	void refill(Magazine* pMagazine);
+	void returnChain(Magazine* pMagazine);
+
+	static Node* toNode(T* p);
+
+	inline static std::atomic<uint64_t> s_nextPoolId = 1;
+	inline static std::atomic<uint64_t> s_numDestroyed = 0;
+	inline static thread_local std::vector<CacheEntry> s_threadCache;
+
+	// Last lookup, trivially initialized so access doesn't go through the thread_local init wrapper
+	inline static thread_local LastEntry s_lastEntry = { 0, nullptr };
+	inline static thread_local uint64_t s_prunedAt = 0; // s_numDestroyed when this thread's cache was last pruned
+
+	const uint64_t _id;
+	const std::shared_ptr<char> _pLifetime;
+
+	mutable std::mutex _depotMutex;
+	std::vector<Chain> _chains;
+	std::vector<std::unique_ptr<Node[]>> _slabs;
+	std::vector<std::unique_ptr<Magazine>> _magazines;
+};
+
+}
+
+#include <pool_object_pool.hpp>
@@ -0,0 +1,344 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <algorithm>
+#include <new>
+#include <pool_object_pool.h>
+
+#define TEMPL_DECL template<class T, size_t MAGAZINE_SIZE, size_t SLAB_SIZE>
+#define POOL_DECL object_pool<T, MAGAZINE_SIZE, SLAB_SIZE>
+
+namespace MultiCore {
+
+TEMPL_DECL
+POOL_DECL::handle::handle(object_pool* pPool, Node* pNode)
+	: _pPool(pPool)
+	, _pNode(pNode)
+{
+}
+
+TEMPL_DECL
+POOL_DECL::handle::handle(const handle& src)
+	: _pPool(src._pPool)
+	, _pNode(src._pNode)
+{
+	if (_pNode)
+		_pNode->_refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+TEMPL_DECL
+POOL_DECL::handle::handle(handle&& src) noexcept
+	: _pPool(src._pPool)
+	, _pNode(src._pNode)
+{
+	src._pPool = nullptr;
+	src._pNode = nullptr;
+}
+
+TEMPL_DECL
+inline POOL_DECL::handle::~handle()
+{
+	reset();
+}
+
+TEMPL_DECL
+typename POOL_DECL::handle& POOL_DECL::handle::operator = (const handle& rhs)
+{
+	if (_pNode != rhs._pNode) {
+		if (rhs._pNode)
+			rhs._pNode->_refs.fetch_add(1, std::memory_order_relaxed);
+		reset();
+		_pPool = rhs._pPool;
+		_pNode = rhs._pNode;
+	}
+
+	return *this;
+}
+
+TEMPL_DECL
+typename POOL_DECL::handle& POOL_DECL::handle::operator = (handle&& rhs) noexcept
+{
+	if (this != &rhs) {
+		reset();
+		_pPool = rhs._pPool;
+		_pNode = rhs._pNode;
+		rhs._pPool = nullptr;
+		rhs._pNode = nullptr;
+	}
+
+	return *this;
+}
+
+TEMPL_DECL
+inline T* POOL_DECL::handle::get() const
+{
+	return _pNode ? (T*)_pNode->_obj : nullptr;
+}
+
+TEMPL_DECL
+inline T& POOL_DECL::handle::operator *() const
+{
+	return *get();
+}
+
+TEMPL_DECL
+inline T* POOL_DECL::handle::operator ->() const
+{
+	return get();
+}
+
+TEMPL_DECL
+inline POOL_DECL::handle::operator bool() const
+{
+	return _pNode != nullptr;
+}
+
+TEMPL_DECL
+inline uint32_t POOL_DECL::handle::use_count() const
+{
+	return _pNode ? _pNode->_refs.load(std::memory_order_relaxed) : 0;
+}
+
+TEMPL_DECL
+inline void POOL_DECL::handle::reset()
+{
+	// Inline, most resets are of the sole owner or an empty handle and the call cost as much as the release
+	if (_pNode) {
+		// The sole owner can skip the atomic decrement, no other thread can be touching the count
+		if (_pNode->_refs.load(std::memory_order_acquire) == 1 || _pNode->_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			_pPool->destroy(get());
+		_pPool = nullptr;
+		_pNode = nullptr;
+	}
+}
+
+TEMPL_DECL
+POOL_DECL::object_pool()
+	: _id(s_nextPoolId.fetch_add(1, std::memory_order_relaxed))
+	, _pLifetime(std::make_shared<char>(0))
+{
+}
+
+TEMPL_DECL
+POOL_DECL::~object_pool()
+{
+	// Ids are never reused, so other threads' entries for this pool are never matched again. Only ours can be removed.
+	if (s_lastEntry._poolId == _id)
+		s_lastEntry = { 0, nullptr };
+
+	auto& cache = s_threadCache;
+	for (size_t i = 0; i < cache.size(); i++) {
+		if (cache[i]._poolId == _id) {
+			cache.erase(cache.begin() + i);
+			break;
+		}
+	}
+
+	// Other threads prune theirs when they see the count change
+	s_numDestroyed.fetch_add(1, std::memory_order_relaxed);
+}
+
+TEMPL_DECL
+template<class... ARGS>
+T* POOL_DECL::create(ARGS&&... args)
+{
+	Node* pNode = allocNode();
+	try {
+		return new(pNode->_obj) T(std::forward<ARGS>(args)...);
+	} catch (...) {
+		freeNode(pNode);
+		throw;
+	}
+}
+
+TEMPL_DECL
+void POOL_DECL::destroy(T* p)
+{
+	if (p) {
+		p->~T();
+		freeNode(toNode(p));
+	}
+}
+
+TEMPL_DECL
+template<class... ARGS>
+typename POOL_DECL::handle POOL_DECL::make_handle(ARGS&&... args)
+{
+	T* p = create(std::forward<ARGS>(args)...);
+	Node* pNode = toNode(p);
+	pNode->_refs.store(1, std::memory_order_relaxed);
+
+	return handle(this, pNode);
+}
+
+TEMPL_DECL
+void POOL_DECL::flushThreadCache()
+{
+	Magazine* pMagazine = getMagazine();
+	if (pMagazine->_count == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(_depotMutex);
+	_chains.push_back(Chain{ pMagazine->_pHead, pMagazine->_count });
+	pMagazine->_pHead = nullptr;
+	pMagazine->_count = 0;
+}
+
+TEMPL_DECL
+size_t POOL_DECL::numSlabs() const
+{
+	std::lock_guard<std::mutex> lock(_depotMutex);
+	return _slabs.size();
+}
+
+TEMPL_DECL
+inline typename POOL_DECL::Magazine* POOL_DECL::getMagazine()
+{
+	if (s_lastEntry._poolId == _id)
+		return s_lastEntry._pMagazine;
+
+	return findMagazine();
+}
+
+TEMPL_DECL
+typename POOL_DECL::Magazine* POOL_DECL::findMagazine()
+{
+	auto& cache = s_threadCache;
+
+	// Drop entries of pools destroyed since the last prune. Their ids are never reused, so they'd only cost search time.
+	uint64_t numDestroyed = s_numDestroyed.load(std::memory_order_relaxed);
+	if (s_prunedAt != numDestroyed) {
+		s_prunedAt = numDestroyed;
+		cache.erase(std::remove_if(cache.begin(), cache.end(), [](const CacheEntry& entry) {
+			return entry._poolLifetime.expired();
+		}), cache.end());
+	}
+
+	// Threads rarely use more than a couple of pools of the same type, a reverse linear search is fastest
+	for (size_t i = cache.size(); i > 0; i--) {
+		if (cache[i - 1]._poolId == _id) {
+			s_lastEntry = { _id, cache[i - 1]._pMagazine };
+			return s_lastEntry._pMagazine;
+		}
+	}
+
+	Magazine* pMagazine = new Magazine;
+	{
+		std::lock_guard<std::mutex> lock(_depotMutex);
+		_magazines.push_back(std::unique_ptr<Magazine>(pMagazine));
+	}
+	cache.push_back(CacheEntry{ _id, pMagazine, _pLifetime });
+	s_lastEntry = { _id, pMagazine };
+
+	return pMagazine;
+}
+
+TEMPL_DECL
+inline typename POOL_DECL::Node* POOL_DECL::allocNode()
+{
+	Magazine* pMagazine = getMagazine();
+	if (!pMagazine->_pHead)
+		refill(pMagazine);
+
+	Node* pNode = pMagazine->_pHead;
+	pMagazine->_pHead = pNode->_pNext;
+	pMagazine->_count--;
+
+	return pNode;
+}
+
+TEMPL_DECL
+inline void POOL_DECL::freeNode(Node* pNode)
+{
+	Magazine* pMagazine = getMagazine();
+	if (pMagazine->_count >= 2 * MAGAZINE_SIZE)
+		returnChain(pMagazine);
+
+	pNode->_pNext = pMagazine->_pHead;
+	pMagazine->_pHead = pNode;
+	pMagazine->_count++;
+}
+
+TEMPL_DECL
+void POOL_DECL::refill(Magazine* pMagazine)
+{
+	std::lock_guard<std::mutex> lock(_depotMutex);
+	if (!_chains.empty()) {
+		const Chain& chain = _chains.back();
+		pMagazine->_pHead = chain._pHead;
+		pMagazine->_count = chain._count;
+		_chains.pop_back();
+		return;
+	}
+
+	// Depot is empty, carve a new slab into chains. The first chain goes straight to the magazine.
+	std::unique_ptr<Node[]> slab(new Node[SLAB_SIZE]);
+	Node* pNodes = slab.get();
+	_slabs.push_back(std::move(slab));
+
+	for (size_t first = 0; first < SLAB_SIZE; first += MAGAZINE_SIZE) {
+		for (size_t i = first; i < first + MAGAZINE_SIZE - 1; i++)
+			pNodes[i]._pNext = &pNodes[i + 1];
+		pNodes[first + MAGAZINE_SIZE - 1]._pNext = nullptr;
+
+		if (first == 0) {
+			pMagazine->_pHead = pNodes;
+			pMagazine->_count = MAGAZINE_SIZE;
+		} else
+			_chains.push_back(Chain{ &pNodes[first], MAGAZINE_SIZE });
+	}
+}
+
+TEMPL_DECL
+void POOL_DECL::returnChain(Magazine* pMagazine)
+{
+	// Split off the first MAGAZINE_SIZE nodes, the walk is amortized over MAGAZINE_SIZE frees
+	Node* pHead = pMagazine->_pHead;
+	Node* pLast = pHead;
+	for (size_t i = 1; i < MAGAZINE_SIZE; i++)
+		pLast = pLast->_pNext;
+
+	pMagazine->_pHead = pLast->_pNext;
+	pMagazine->_count -= MAGAZINE_SIZE;
+	pLast->_pNext = nullptr;
+
+	std::lock_guard<std::mutex> lock(_depotMutex);
+	_chains.push_back(Chain{ pHead, MAGAZINE_SIZE });
+}
+
+TEMPL_DECL
+inline typename POOL_DECL::Node* POOL_DECL::toNode(T* p)
+{
+	// The object storage is the first member of Node
+	return (Node*)p;
+}
+
+}
+
+#undef TEMPL_DECL
+#undef POOL_DECL
@@ -46,6 +46,7 @@ public:
 
 	set() = default;
 	set(const set& src) = default;
+	set(set&& src) = default;
 	set(const MultiCore::vector<T>& src);
 	set(const std::set<T>& src);
 	set(const std::initializer_list<T>& src);
@@ -61,12 +62,15 @@ public:
 	void insert(const std::initializer_list<T>& vals);
 	template<class ITER_TYPE>
 	void insert(const ITER_TYPE& begin, const ITER_TYPE& end);
+	template<class RANGE>
+	void insert_range(const RANGE& vals);
 
 	void erase(const T& val);
 	void erase(const const_iterator& at);
 	void erase(const const_iterator& begin, const const_iterator& end);
 
 	set& operator = (const set& rhs);
+	set& operator = (set&& rhs) = default;
 
 	const_iterator begin() const noexcept;
 	const_iterator end() const noexcept;
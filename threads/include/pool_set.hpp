@@ -27,6 +27,7 @@ This file is part of the DistFieldHexMesh application/library.
 */
 
 #include <assert.h>
+#include <algorithm>
 #include <local_heap.h>
 #include <pool_vector.h>
 
@@ -75,9 +76,64 @@ void SET_DECL::insert(const ITER_TYPE& begin, const ITER_TYPE& end)
 	_set.insert(begin, end);
 #endif
 
-	for (auto iter = begin; iter != end; iter++) {
-		insert(*iter);
+	/*
+		Inserting one at a time shifts the tail for every entry, O(n^2) to build a set.
+		Instead, sort the new entries and merge them with ours in a single O(n + m) pass.
+		On equal values, the entry already in the set is kept, same as std::set.
+	*/
+	vector<T> added;
+	added.insert(added.end(), begin, end);
+	if (added.empty())
+		return;
+
+	T* pAdded = added.data();
+	size_t numAdded = added.size();
+	std::stable_sort(pAdded, pAdded + numAdded);
+
+	if (empty()) {
+		auto pEnd = std::unique(pAdded, pAdded + numAdded, [](const T& lhs, const T& rhs) {
+			return !(lhs < rhs) && !(rhs < lhs);
+		});
+		added.erase(added.begin() + (size_t)(pEnd - pAdded), added.end());
+		vector<T>::swap(added);
+		return;
 	}
+
+	T* pOurs = vector<T>::data();
+	size_t numOurs = size();
+
+	vector<T> merged;
+	merged.reserve(numOurs + numAdded);
+	size_t i = 0, j = 0;
+	while (i < numOurs && j < numAdded) {
+		if (pAdded[j] < pOurs[i]) {
+			if (merged.empty() || merged.back() < pAdded[j])
+				merged.emplace_back(std::move(pAdded[j]));
+			j++;
+		} else if (pOurs[i] < pAdded[j]) {
+			merged.emplace_back(std::move(pOurs[i++]));
+		} else {
+			merged.emplace_back(std::move(pOurs[i++]));
+			j++;
+		}
+	}
+
+	while (i < numOurs)
+		merged.emplace_back(std::move(pOurs[i++]));
+
+	for (; j < numAdded; j++) {
+		if (merged.empty() || merged.back() < pAdded[j])
+			merged.emplace_back(std::move(pAdded[j]));
+	}
+
+	vector<T>::swap(merged);
+}
+
+TEMPL_DECL
+template<class RANGE>
+inline void SET_DECL::insert_range(const RANGE& vals)
+{
+	insert(std::begin(vals), std::end(vals));
 }
 
 TEMPL_DECL
@@ -119,9 +175,7 @@ void SET_DECL::insert(const std::initializer_list<T>& vals)
 	_set.insert(vals.begin(), vals.end());
 #endif
 
-	for (auto iter = begin; iter != end; iter++) {
-		insert(*iter);
-	}
+	insert(vals.begin(), vals.end());
 }
 
 TEMPL_DECL
@@ -208,42 +262,30 @@ inline size_t SET_DECL::count(const T& val) const
 TEMPL_DECL
 typename SET_DECL::const_iterator SET_DECL::find(const T& val, const_iterator& next) const noexcept
 {
-	next = end();
-	size_t min = 0;
-	size_t max = size();
-	size_t idx = (min + max) / 2;
-	while (idx < size() && min != max) {
-		const auto& curVal = vector<T>::operator[](idx);
-		if (val < curVal) {
-			if (max == idx) {
-				assert(!"Unexpected/impossible condition.");
-			}
-			max = idx;
-		} else if (curVal < val) {
-			if (min == idx) {
-				if (idx < size() - 1)
-					next = const_iterator(this, vector<T>::data() + idx + 1);
-				else
-					next = end();
-				return end();
-
-			}
-			min = idx;
-		} else {
-			if (idx < size() - 1)
-				next = const_iterator(this, vector<T>::data() + idx + 1);
-			else
-				next = end();
-			return const_iterator(this, vector<T>::data() + idx);
-		}
+	// Branchless lower bound. The loop trip count only depends on size, so it doesn't mispredict
+	// and the compiler can turn the step into a conditional move.
+	size_t num = size();
+	if (num == 0) {
+		next = end();
+		return end();
+	}
 
-		idx = (min + max) / 2;
+	const T* pBase = vector<T>::data();
+	while (num > 1) {
+		size_t half = num / 2;
+		pBase = (pBase[half] < val) ? pBase + half : pBase;
+		num -= half;
 	}
+	if (*pBase < val)
+		pBase++;
 
-	if (idx < size()) {
-		next = const_iterator(this, vector<T>::data() + idx);
+	const T* pEnd = vector<T>::data() + size();
+	if (pBase != pEnd && !(val < *pBase)) {
+		next = const_iterator(this, pBase + 1);
+		return const_iterator(this, pBase);
 	}
 
+	next = const_iterator(this, pBase);
 	return end();
 }
 
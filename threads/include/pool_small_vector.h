@@ -0,0 +1,68 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <pool_vector.h>
+
+namespace MultiCore
+{
+
+/*
+	MultiCore::vector with room for N entries inside the object. Nothing is allocated from the local heap until the
+	vector grows past N, after which it behaves exactly like MultiCore::vector. Use it for the many short lists, such as
+	adjacency, where the heap block and header cost more than the data.
+
+	Unlike MultiCore::vector, it isn't trivially relocatable. It's usable anywhere a MultiCore::vector<T>& is expected.
+*/
+template<class T, size_t N = 8>
+class small_vector : public vector<T> {
+public:
+	small_vector();
+	small_vector(const small_vector& src);
+	small_vector(const vector<T>& src);
+	small_vector(small_vector&& src) noexcept;
+	small_vector(vector<T>&& src) noexcept;
+	small_vector(const std::initializer_list<T>& src);
+	~small_vector();
+
+	small_vector& operator = (const small_vector& rhs);
+	small_vector& operator = (const vector<T>& rhs);
+	small_vector& operator = (small_vector&& rhs) noexcept;
+	small_vector& operator = (vector<T>&& rhs) noexcept;
+
+	// Moves the entries back into the object once they fit. Called through a vector<T>&, the entries stay on the heap.
+	void shrink_to_fit();
+
+private:
+	T* inlineBuf();
+
+	alignas(T) char _inlineBuf[N * sizeof(T)];
+};
+
+}
+
+#include <pool_small_vector.hpp>
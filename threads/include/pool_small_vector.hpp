@@ -0,0 +1,133 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <assert.h>
+#include <pool_small_vector.h>
+
+#define TEMPL_DECL template<class T, size_t N> 
+#define SMALL_VECTOR_DECL small_vector<T, N> 
+
+namespace MultiCore {
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector()
+	: vector<T>(inlineBuf(), N)
+{
+	assert(vector<T>::isInline());
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector(const small_vector& src)
+	: small_vector()
+{
+	vector<T>::operator = (src);
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector(const vector<T>& src)
+	: small_vector()
+{
+	vector<T>::operator = (src);
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector(small_vector&& src) noexcept
+	: small_vector()
+{
+	vector<T>::operator = (std::move(src));
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector(vector<T>&& src) noexcept
+	: small_vector()
+{
+	vector<T>::operator = (std::move(src));
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::small_vector(const std::initializer_list<T>& src)
+	: small_vector()
+{
+	vector<T>::insert(vector<T>::end(), src);
+}
+
+TEMPL_DECL
+SMALL_VECTOR_DECL::~small_vector()
+{
+	// Destroy the inline entries and detach from the buffer, the base destructor only handles heap storage
+	if (vector<T>::isInline())
+		vector<T>::releaseData();
+}
+
+TEMPL_DECL
+inline SMALL_VECTOR_DECL& SMALL_VECTOR_DECL::operator = (const small_vector& rhs)
+{
+	vector<T>::operator = (rhs);
+	return *this;
+}
+
+TEMPL_DECL
+inline SMALL_VECTOR_DECL& SMALL_VECTOR_DECL::operator = (const vector<T>& rhs)
+{
+	vector<T>::operator = (rhs);
+	return *this;
+}
+
+TEMPL_DECL
+inline SMALL_VECTOR_DECL& SMALL_VECTOR_DECL::operator = (small_vector&& rhs) noexcept
+{
+	vector<T>::operator = (std::move(rhs));
+	return *this;
+}
+
+TEMPL_DECL
+inline SMALL_VECTOR_DECL& SMALL_VECTOR_DECL::operator = (vector<T>&& rhs) noexcept
+{
+	vector<T>::operator = (std::move(rhs));
+	return *this;
+}
+
+TEMPL_DECL
+void SMALL_VECTOR_DECL::shrink_to_fit()
+{
+	if (vector<T>::size() <= N)
+		vector<T>::moveToInline(N);
+	else
+		vector<T>::shrink_to_fit();
+}
+
+TEMPL_DECL
+inline T* SMALL_VECTOR_DECL::inlineBuf()
+{
+	return (T*)_inlineBuf;
+}
+
+}
+
+#undef TEMPL_DECL
+#undef SMALL_VECTOR_DECL
@@ -0,0 +1,113 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <local_heap.h>
+#include <pool_vector.h>
+
+namespace MultiCore
+{
+
+/*
+	Structure of arrays container, one column per field. All columns share a single local heap allocation and each
+	column starts on a COLUMN_ALIGNMENT boundary, so per vertex kernels and VBO packing can stream aligned, contiguous data.
+
+	e.g. soa_vector<Vector3f, Vector3f, Vector2f> verts; // points, normals, parameters
+		verts.push_back(pt, norm, uv);
+		std::span<Vector3f> pts = verts.column<0>();
+
+	Fields must be trivially copyable, growth is a memcpy per column.
+*/
+template<class... FIELDS>
+class soa_vector : private local_heap_user {
+public:
+	static constexpr size_t NUM_COLUMNS = sizeof...(FIELDS);
+	static constexpr size_t COLUMN_ALIGNMENT = 64;
+
+	template<size_t I>
+	using field_type = std::tuple_element_t<I, std::tuple<FIELDS...>>;
+
+	static_assert(NUM_COLUMNS > 0, "soa_vector requires at least one field");
+	static_assert((std::is_trivially_copyable_v<FIELDS> && ...), "soa_vector fields must be trivially copyable");
+	static_assert(((alignof(FIELDS) <= COLUMN_ALIGNMENT) && ...), "soa_vector field alignment exceeds the column alignment");
+
+	soa_vector() = default;
+	soa_vector(const soa_vector& src);
+	soa_vector(soa_vector&& src) noexcept;
+	~soa_vector();
+
+	soa_vector& operator = (const soa_vector& rhs);
+	soa_vector& operator = (soa_vector&& rhs) noexcept;
+
+	bool empty() const;
+	size_t size() const;
+	size_t capacity() const;
+	void clear();
+	void reserve(size_t val);
+	void resize(size_t val);
+
+	size_t push_back(const FIELDS&... vals);
+	void pop_back();
+
+	template<size_t I>
+	const field_type<I>* data() const;
+	template<size_t I>
+	field_type<I>* data();
+
+	template<size_t I>
+	std::span<const field_type<I>> column() const;
+	template<size_t I>
+	std::span<field_type<I>> column();
+
+	template<size_t I>
+	const field_type<I>& get(size_t idx) const;
+	template<size_t I>
+	field_type<I>& get(size_t idx);
+
+private:
+	static size_t columnBytes(size_t capacity, size_t fieldSize);
+	void reallocate(size_t newCapacity);
+	void releaseData();
+
+	template<size_t... Is>
+	void setEntry(size_t idx, std::index_sequence<Is...>, const FIELDS&... vals);
+	template<size_t... Is>
+	void constructEntries(size_t first, size_t last, std::index_sequence<Is...>);
+
+	size_t _size = 0, _capacity = 0;
+	char* _pMem = nullptr;
+	char* _pColumns[NUM_COLUMNS] = {};
+};
+
+}
+
+#include <pool_soa_vector.hpp>
@@ -0,0 +1,294 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <cstring>
+#include <memory>
+#include <pool_soa_vector.h>
+
+#define TEMPL_DECL template<class... FIELDS> 
+#define SOA_DECL soa_vector<FIELDS...> 
+
+namespace MultiCore {
+
+TEMPL_DECL
+SOA_DECL::soa_vector(const soa_vector& src)
+{
+	*this = src;
+}
+
+TEMPL_DECL
+SOA_DECL::soa_vector(soa_vector&& src) noexcept
+{
+	// The storage belongs to src's heap, so we have to use it too.
+	useHeapOf(src);
+	_size = src._size;
+	_capacity = src._capacity;
+	_pMem = src._pMem;
+	for (size_t i = 0; i < NUM_COLUMNS; i++) {
+		_pColumns[i] = src._pColumns[i];
+		src._pColumns[i] = nullptr;
+	}
+
+	src._size = 0;
+	src._capacity = 0;
+	src._pMem = nullptr;
+}
+
+TEMPL_DECL
+SOA_DECL::~soa_vector()
+{
+	releaseData();
+}
+
+TEMPL_DECL
+SOA_DECL& SOA_DECL::operator = (const soa_vector& rhs)
+{
+	if (this == &rhs)
+		return *this;
+
+	_size = 0;
+	reserve(rhs._size);
+
+	constexpr size_t fieldSizes[] = { sizeof(FIELDS)... };
+	for (size_t i = 0; i < NUM_COLUMNS; i++) {
+		if (rhs._size > 0)
+			memcpy(_pColumns[i], rhs._pColumns[i], rhs._size * fieldSizes[i]);
+	}
+	_size = rhs._size;
+
+	return *this;
+}
+
+TEMPL_DECL
+SOA_DECL& SOA_DECL::operator = (soa_vector&& rhs) noexcept
+{
+	if (this == &rhs)
+		return *this;
+
+	if (isSameHeap(rhs)) {
+		releaseData();
+
+		_size = rhs._size;
+		_capacity = rhs._capacity;
+		_pMem = rhs._pMem;
+		for (size_t i = 0; i < NUM_COLUMNS; i++) {
+			_pColumns[i] = rhs._pColumns[i];
+			rhs._pColumns[i] = nullptr;
+		}
+
+		rhs._size = 0;
+		rhs._capacity = 0;
+		rhs._pMem = nullptr;
+	} else {
+		// The storage can't change heaps, copy the columns instead.
+		*this = (const soa_vector&)rhs;
+		rhs.clear();
+	}
+
+	return *this;
+}
+
+TEMPL_DECL
+inline bool SOA_DECL::empty() const
+{
+	return _size == 0;
+}
+
+TEMPL_DECL
+inline size_t SOA_DECL::size() const
+{
+	return _size;
+}
+
+TEMPL_DECL
+inline size_t SOA_DECL::capacity() const
+{
+	return _capacity;
+}
+
+TEMPL_DECL
+inline void SOA_DECL::clear()
+{
+	// Fields are trivially destructible, keep the capacity
+	_size = 0;
+}
+
+TEMPL_DECL
+void SOA_DECL::reserve(size_t val)
+{
+	if (val > _capacity)
+		reallocate(val);
+}
+
+TEMPL_DECL
+void SOA_DECL::resize(size_t val)
+{
+	// One pass for all columns, instead of one resize per parallel array
+	if (val > _capacity) {
+		size_t newCapacity = (size_t)(_capacity * POOL_VECTOR_GROWTH_FACTOR);
+		reallocate(newCapacity > val ? newCapacity : val);
+	}
+
+	if (val > _size)
+		constructEntries(_size, val, std::index_sequence_for<FIELDS...>());
+	_size = val;
+}
+
+TEMPL_DECL
+size_t SOA_DECL::push_back(const FIELDS&... vals)
+{
+	if (_size + 1 > _capacity) {
+		// The values may be entries of this vector, copy them before the old columns are freed
+		std::tuple<FIELDS...> copies(vals...);
+
+		size_t newCapacity = (size_t)(_capacity * POOL_VECTOR_GROWTH_FACTOR);
+		if (newCapacity < 8)
+			newCapacity = 8;
+		reallocate(newCapacity);
+
+		std::apply([this](const FIELDS&... copied) {
+			setEntry(_size, std::index_sequence_for<FIELDS...>(), copied...);
+		}, copies);
+	} else {
+		setEntry(_size, std::index_sequence_for<FIELDS...>(), vals...);
+	}
+	_size++;
+
+	return _size;
+}
+
+TEMPL_DECL
+inline void SOA_DECL::pop_back()
+{
+	_size--;
+}
+
+TEMPL_DECL
+template<size_t I>
+inline const typename SOA_DECL::template field_type<I>* SOA_DECL::data() const
+{
+	return (const field_type<I>*)_pColumns[I];
+}
+
+TEMPL_DECL
+template<size_t I>
+inline typename SOA_DECL::template field_type<I>* SOA_DECL::data()
+{
+	return (field_type<I>*)_pColumns[I];
+}
+
+TEMPL_DECL
+template<size_t I>
+inline std::span<const typename SOA_DECL::template field_type<I>> SOA_DECL::column() const
+{
+	return std::span<const field_type<I>>(data<I>(), _size);
+}
+
+TEMPL_DECL
+template<size_t I>
+inline std::span<typename SOA_DECL::template field_type<I>> SOA_DECL::column()
+{
+	return std::span<field_type<I>>(data<I>(), _size);
+}
+
+TEMPL_DECL
+template<size_t I>
+inline const typename SOA_DECL::template field_type<I>& SOA_DECL::get(size_t idx) const
+{
+	return data<I>()[idx];
+}
+
+TEMPL_DECL
+template<size_t I>
+inline typename SOA_DECL::template field_type<I>& SOA_DECL::get(size_t idx)
+{
+	return data<I>()[idx];
+}
+
+TEMPL_DECL
+inline size_t SOA_DECL::columnBytes(size_t capacity, size_t fieldSize)
+{
+	return (capacity * fieldSize + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+}
+
+TEMPL_DECL
+void SOA_DECL::reallocate(size_t newCapacity)
+{
+	constexpr size_t fieldSizes[] = { sizeof(FIELDS)... };
+
+	// local_heap only guarantees 16 byte alignment, pad so the first column can be aligned
+	size_t totalBytes = COLUMN_ALIGNMENT - 1;
+	for (size_t i = 0; i < NUM_COLUMNS; i++)
+		totalBytes += columnBytes(newCapacity, fieldSizes[i]);
+
+	char* pMem = allocRaw<char>(totalBytes);
+	char* pCol = (char*)(((uintptr_t)pMem + COLUMN_ALIGNMENT - 1) & ~(uintptr_t)(COLUMN_ALIGNMENT - 1));
+	for (size_t i = 0; i < NUM_COLUMNS; i++) {
+		if (_size > 0)
+			memcpy(pCol, _pColumns[i], _size * fieldSizes[i]);
+		_pColumns[i] = pCol;
+		pCol += columnBytes(newCapacity, fieldSizes[i]);
+	}
+
+	if (_pMem)
+		free(_pMem);
+	_pMem = pMem;
+	_capacity = newCapacity;
+}
+
+TEMPL_DECL
+void SOA_DECL::releaseData()
+{
+	if (_pMem)
+		free(_pMem);
+
+	_pMem = nullptr;
+	for (size_t i = 0; i < NUM_COLUMNS; i++)
+		_pColumns[i] = nullptr;
+	_size = 0;
+	_capacity = 0;
+}
+
+TEMPL_DECL
+template<size_t... Is>
+inline void SOA_DECL::setEntry(size_t idx, std::index_sequence<Is...>, const FIELDS&... vals)
+{
+	((data<Is>()[idx] = vals), ...);
+}
+
+TEMPL_DECL
+template<size_t... Is>
+inline void SOA_DECL::constructEntries(size_t first, size_t last, std::index_sequence<Is...>)
+{
+	(std::uninitialized_value_construct(data<Is>() + first, data<Is>() + last), ...);
+}
+
+}
+
+#undef TEMPL_DECL
+#undef SOA_DECL
@@ -0,0 +1,171 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <local_heap.h>
+
+#define FORW_CONST 0
+#define FORW 2
+#define IS_CONST (IterType < FORW)
+
+namespace MultiCore
+{
+
+/*
+	Hash map using open addressing, SwissTable style. Use it instead of MultiCore::map when ordering isn't needed.
+
+	Each slot has a control byte, empty, deleted or the low 7 bits of the key's hash. Lookups scan 8 control bytes at a time
+	with plain 64 bit integer math and only compare keys whose 7 bit hash matches. The slots and control bytes are a single
+	allocation from the local heap.
+
+	Iterators and pointers are invalidated by any insert which grows the table. Erase leaves a tombstone, tombstones are
+	dropped when the table is rehashed.
+*/
+template<class KEY, class T, class HASH = std::hash<KEY>, class EQ = std::equal_to<KEY>>
+class unordered_map : private local_heap_user {
+public:
+	using DataPair = std::pair<KEY, T>;
+	using DataMap = MultiCore::unordered_map<KEY, T, HASH, EQ>;
+
+private:
+	template <int IterType>
+	class _iterator
+	{
+	public:
+		friend class MultiCore::unordered_map<KEY, T, HASH, EQ>;
+		template <int OtherType>
+		friend class _iterator;
+
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+
+		using value_type = DataPair;
+		using dataMap = std::conditional_t<IS_CONST, const DataMap, DataMap>;
+		using pointer = std::conditional_t<IS_CONST, DataPair const*, DataPair*>;
+		using reference = std::conditional_t<IS_CONST, DataPair const&, DataPair&>;
+
+		_iterator() = default;
+		_iterator(dataMap* pSource, size_t idx);
+		_iterator(const _iterator& src) = default;
+		template <int OtherType>
+		_iterator(const _iterator<OtherType>& src);
+
+		bool operator == (const _iterator& rhs) const;
+		bool operator != (const _iterator& rhs) const;
+
+		_iterator& operator ++ ();		// prefix
+		_iterator operator ++ (int);	// postfix
+
+		reference operator *() const;
+		pointer operator->() const;
+
+	private:
+		void skipUnused();
+
+		dataMap* _pSource = nullptr;
+		size_t _idx = 0;
+	};
+
+public:
+	using iterator = _iterator<FORW>;
+	using const_iterator = _iterator<FORW_CONST>;
+
+	unordered_map() = default;
+	unordered_map(const unordered_map& src);
+	unordered_map(unordered_map&& src) noexcept;
+	unordered_map(const std::initializer_list<DataPair>& src);
+	~unordered_map();
+
+	unordered_map& operator = (const unordered_map& rhs);
+	unordered_map& operator = (unordered_map&& rhs) noexcept;
+
+	bool empty() const;
+	size_t size() const;
+	size_t capacity() const;
+	void clear();
+	void reserve(size_t num);
+
+	std::pair<iterator, bool> insert(const DataPair& pair);
+	std::pair<iterator, bool> insert(DataPair&& pair);
+
+	size_t erase(const KEY& key);
+	iterator erase(const const_iterator& at);
+
+	iterator find(const KEY& key) noexcept;
+	const_iterator find(const KEY& key) const noexcept;
+	size_t count(const KEY& key) const;
+	bool contains(const KEY& key) const;
+
+	const T& operator[](const KEY& key) const;
+	T& operator[](const KEY& key);
+
+	iterator begin() noexcept;
+	iterator end() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	static constexpr int8_t CTRL_EMPTY = -128;	// 0x80
+	static constexpr int8_t CTRL_DELETED = -2;	// 0xFE
+	static constexpr size_t GROUP_WIDTH = 8;
+	static constexpr size_t NOT_FOUND = SIZE_MAX;
+
+	static size_t hashOf(const KEY& key);
+	static int8_t h2(size_t hash);
+	static size_t maxLoad(size_t capacity);
+
+	static uint64_t loadGroup(const int8_t* pCtrl);
+	static uint64_t matchByte(uint64_t group, int8_t val);
+	static uint64_t matchEmpty(uint64_t group);
+	static uint64_t matchEmptyOrDeleted(uint64_t group);
+	static size_t firstMatch(uint64_t mask);
+
+	size_t findIndex(const KEY& key, size_t hash) const;
+	size_t findFreeIndex(size_t hash) const;
+	size_t prepareInsert(size_t hash);
+	void eraseIndex(size_t idx);
+	void setCtrl(size_t idx, int8_t val);
+	void allocTable(size_t capacity);
+	void rehash(size_t capacity);
+	void destroyAll();
+
+	size_t _size = 0, _numDeleted = 0, _capacity = 0;
+	char* _pMem = nullptr;
+	DataPair* _pSlots = nullptr;
+	int8_t* _pCtrl = nullptr;
+};
+
+}
+
+#include <pool_unordered_map.hpp>
+
+#undef FORW_CONST
+#undef FORW
+#undef IS_CONST
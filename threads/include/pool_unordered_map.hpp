@@ -0,0 +1,581 @@
+#pragma once
+/*
+This file is part of the DistFieldHexMesh application/library.
+
+	The DistFieldHexMesh application/library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	The DistFieldHexMesh application/library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	This link provides the exact terms of the GPL license <https://www.gnu.org/licenses/>.
+
+	The author's interpretation of GPL 3 is that if you receive money for the use or distribution of the DistFieldHexMesh application/library or a derivative product, GPL 3 no longer applies.
+
+	Under those circumstances, the author expects and may legally pursue a reasoble share of the income. To avoid the complexity of agreements and negotiation, the author makes
+	no specific demands in this regard. Compensation of roughly 1% of net or $5 per user license seems appropriate, but is not legally binding.
+
+	In lay terms, if you make a profit by using the DistFieldHexMesh application/library (violating the spirit of Open Source Software), I expect a reasonable share for my efforts.
+
+	Robert R Tipton - Author
+
+	Dark Sky Innovative Solutions http://darkskyinnovation.com/
+*/
+
+#include <bit>
+#include <cstring>
+#include <local_heap.h>
+#include <pool_unordered_map.h>
+
+#define TEMPL_DECL template<class KEY, class T, class HASH, class EQ>
+#define ITER_TEMPL_DECL template <int IterType>
+#define MAP_DECL MultiCore::unordered_map<KEY, T, HASH, EQ>
+#define ITER_DECL MultiCore::unordered_map<KEY, T, HASH, EQ>::_iterator<IterType>
+
+namespace MultiCore {
+
+TEMPL_DECL
+MAP_DECL::unordered_map(const unordered_map& src)
+{
+	reserve(src._size);
+	for (const auto& pair : src)
+		insert(pair);
+}
+
+TEMPL_DECL
+MAP_DECL::unordered_map(unordered_map&& src) noexcept
+{
+	// The table belongs to src's heap, so we have to use it too.
+	useHeapOf(src);
+	_size = src._size;
+	_numDeleted = src._numDeleted;
+	_capacity = src._capacity;
+	_pMem = src._pMem;
+	_pSlots = src._pSlots;
+	_pCtrl = src._pCtrl;
+
+	src._size = 0;
+	src._numDeleted = 0;
+	src._capacity = 0;
+	src._pMem = nullptr;
+	src._pSlots = nullptr;
+	src._pCtrl = nullptr;
+}
+
+TEMPL_DECL
+MAP_DECL::unordered_map(const std::initializer_list<DataPair>& src)
+{
+	reserve(src.size());
+	for (const auto& pair : src)
+		insert(pair);
+}
+
+TEMPL_DECL
+MAP_DECL::~unordered_map()
+{
+	destroyAll();
+	if (_pMem)
+		free(_pMem);
+}
+
+TEMPL_DECL
+MAP_DECL& MAP_DECL::operator = (const unordered_map& rhs)
+{
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	reserve(rhs._size);
+	for (const auto& pair : rhs)
+		insert(pair);
+
+	return *this;
+}
+
+TEMPL_DECL
+MAP_DECL& MAP_DECL::operator = (unordered_map&& rhs) noexcept
+{
+	if (this == &rhs)
+		return *this;
+
+	if (isSameHeap(rhs)) {
+		destroyAll();
+		if (_pMem)
+			free(_pMem);
+
+		_size = rhs._size;
+		_numDeleted = rhs._numDeleted;
+		_capacity = rhs._capacity;
+		_pMem = rhs._pMem;
+		_pSlots = rhs._pSlots;
+		_pCtrl = rhs._pCtrl;
+
+		rhs._size = 0;
+		rhs._numDeleted = 0;
+		rhs._capacity = 0;
+		rhs._pMem = nullptr;
+		rhs._pSlots = nullptr;
+		rhs._pCtrl = nullptr;
+	} else {
+		// The table can't change heaps, move the entries instead.
+		clear();
+		reserve(rhs._size);
+		for (auto& pair : rhs)
+			insert(std::move(pair));
+		rhs.clear();
+	}
+
+	return *this;
+}
+
+TEMPL_DECL
+inline bool MAP_DECL::empty() const
+{
+	return _size == 0;
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::size() const
+{
+	return _size;
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::capacity() const
+{
+	return _capacity;
+}
+
+TEMPL_DECL
+void MAP_DECL::clear()
+{
+	destroyAll();
+	if (_pCtrl)
+		memset(_pCtrl, CTRL_EMPTY, _capacity + GROUP_WIDTH);
+	_size = 0;
+	_numDeleted = 0;
+}
+
+TEMPL_DECL
+void MAP_DECL::reserve(size_t num)
+{
+	size_t newCapacity = GROUP_WIDTH;
+	while (maxLoad(newCapacity) < num)
+		newCapacity *= 2;
+
+	if (newCapacity > _capacity)
+		rehash(newCapacity);
+}
+
+TEMPL_DECL
+std::pair<typename MAP_DECL::iterator, bool> MAP_DECL::insert(const DataPair& pair)
+{
+	size_t hash = hashOf(pair.first);
+	size_t idx = findIndex(pair.first, hash);
+	if (idx != NOT_FOUND)
+		return std::make_pair(iterator(this, idx), false);
+
+	idx = prepareInsert(hash);
+	new(&_pSlots[idx]) DataPair(pair);
+
+	return std::make_pair(iterator(this, idx), true);
+}
+
+TEMPL_DECL
+std::pair<typename MAP_DECL::iterator, bool> MAP_DECL::insert(DataPair&& pair)
+{
+	size_t hash = hashOf(pair.first);
+	size_t idx = findIndex(pair.first, hash);
+	if (idx != NOT_FOUND)
+		return std::make_pair(iterator(this, idx), false);
+
+	idx = prepareInsert(hash);
+	new(&_pSlots[idx]) DataPair(std::move(pair));
+
+	return std::make_pair(iterator(this, idx), true);
+}
+
+TEMPL_DECL
+size_t MAP_DECL::erase(const KEY& key)
+{
+	size_t idx = findIndex(key, hashOf(key));
+	if (idx == NOT_FOUND)
+		return 0;
+
+	eraseIndex(idx);
+	return 1;
+}
+
+TEMPL_DECL
+typename MAP_DECL::iterator MAP_DECL::erase(const const_iterator& at)
+{
+	size_t idx = at._idx;
+	if (idx < _capacity && _pCtrl[idx] >= 0)
+		eraseIndex(idx);
+
+	iterator result(this, idx);
+	result.skipUnused();
+	return result;
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::iterator MAP_DECL::find(const KEY& key) noexcept
+{
+	size_t idx = findIndex(key, hashOf(key));
+	return idx != NOT_FOUND ? iterator(this, idx) : end();
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::const_iterator MAP_DECL::find(const KEY& key) const noexcept
+{
+	size_t idx = findIndex(key, hashOf(key));
+	return idx != NOT_FOUND ? const_iterator(this, idx) : end();
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::count(const KEY& key) const
+{
+	return findIndex(key, hashOf(key)) != NOT_FOUND ? 1 : 0;
+}
+
+TEMPL_DECL
+inline bool MAP_DECL::contains(const KEY& key) const
+{
+	return findIndex(key, hashOf(key)) != NOT_FOUND;
+}
+
+TEMPL_DECL
+inline const T& MAP_DECL::operator[](const KEY& key) const
+{
+	return find(key)->second;
+}
+
+TEMPL_DECL
+T& MAP_DECL::operator[](const KEY& key)
+{
+	size_t hash = hashOf(key);
+	size_t idx = findIndex(key, hash);
+	if (idx == NOT_FOUND) {
+		idx = prepareInsert(hash);
+		new(&_pSlots[idx]) DataPair(key, T());
+	}
+
+	return _pSlots[idx].second;
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::iterator MAP_DECL::begin() noexcept
+{
+	iterator result(this, 0);
+	result.skipUnused();
+	return result;
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::iterator MAP_DECL::end() noexcept
+{
+	return iterator(this, _capacity);
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::const_iterator MAP_DECL::begin() const noexcept
+{
+	const_iterator result(this, 0);
+	result.skipUnused();
+	return result;
+}
+
+TEMPL_DECL
+inline typename MAP_DECL::const_iterator MAP_DECL::end() const noexcept
+{
+	return const_iterator(this, _capacity);
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::hashOf(const KEY& key)
+{
+	// std::hash is the identity for integers on some platforms. Mix it so both the probe start and the
+	// 7 bit tag get well distributed bits.
+	uint64_t h = (uint64_t)HASH()(key) * 0x9E3779B97F4A7C15ull;
+	return (size_t)(h ^ (h >> 32));
+}
+
+TEMPL_DECL
+inline int8_t MAP_DECL::h2(size_t hash)
+{
+	return (int8_t)(hash & 0x7f);
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::maxLoad(size_t capacity)
+{
+	// 7/8 load factor
+	return capacity - capacity / 8;
+}
+
+/*
+	Group operations. Bytes are packed little endian, so the lowest set bit of a mask belongs to the first slot in the group.
+	These are the portable versions of the SSE2 ones, every platform we target has fast 64 bit integer ops.
+*/
+TEMPL_DECL
+inline uint64_t MAP_DECL::loadGroup(const int8_t* pCtrl)
+{
+	uint64_t group;
+	memcpy(&group, pCtrl, sizeof(group));
+	return group;
+}
+
+TEMPL_DECL
+inline uint64_t MAP_DECL::matchByte(uint64_t group, int8_t val)
+{
+	// Zero byte test. It can report a false match just above a true one, the key compare rejects those.
+	constexpr uint64_t lsbs = 0x0101010101010101ull;
+	constexpr uint64_t msbs = 0x8080808080808080ull;
+	uint64_t x = group ^ (lsbs * (uint8_t)val);
+	return (x - lsbs) & ~x & msbs;
+}
+
+TEMPL_DECL
+inline uint64_t MAP_DECL::matchEmpty(uint64_t group)
+{
+	// Empty is the only control value with the high bit set and bit 1 clear
+	constexpr uint64_t msbs = 0x8080808080808080ull;
+	return group & ~(group << 6) & msbs;
+}
+
+TEMPL_DECL
+inline uint64_t MAP_DECL::matchEmptyOrDeleted(uint64_t group)
+{
+	constexpr uint64_t msbs = 0x8080808080808080ull;
+	return group & ~(group << 7) & msbs;
+}
+
+TEMPL_DECL
+inline size_t MAP_DECL::firstMatch(uint64_t mask)
+{
+	return (size_t)std::countr_zero(mask) / 8;
+}
+
+TEMPL_DECL
+size_t MAP_DECL::findIndex(const KEY& key, size_t hash) const
+{
+	if (_size == 0)
+		return NOT_FOUND;
+
+	// Triangular probing over groups. With a power of 2 capacity this visits every group.
+	size_t mask = _capacity - 1;
+	size_t pos = (hash >> 7) & mask;
+	size_t step = 0;
+	int8_t tag = h2(hash);
+	while (true) {
+		uint64_t group = loadGroup(_pCtrl + pos);
+		for (uint64_t match = matchByte(group, tag); match != 0; match &= match - 1) {
+			size_t idx = (pos + firstMatch(match)) & mask;
+			if (EQ()(_pSlots[idx].first, key))
+				return idx;
+		}
+
+		if (matchEmpty(group) != 0)
+			return NOT_FOUND;
+
+		step += GROUP_WIDTH;
+		pos = (pos + step) & mask;
+	}
+}
+
+TEMPL_DECL
+size_t MAP_DECL::findFreeIndex(size_t hash) const
+{
+	size_t mask = _capacity - 1;
+	size_t pos = (hash >> 7) & mask;
+	size_t step = 0;
+	while (true) {
+		uint64_t match = matchEmptyOrDeleted(loadGroup(_pCtrl + pos));
+		if (match != 0)
+			return (pos + firstMatch(match)) & mask;
+
+		step += GROUP_WIDTH;
+		pos = (pos + step) & mask;
+	}
+}
+
+TEMPL_DECL
+size_t MAP_DECL::prepareInsert(size_t hash)
+{
+	// Returns a free slot with its control byte set. The caller must construct the entry.
+	if (_size + _numDeleted + 1 > maxLoad(_capacity)) {
+		if (_capacity == 0)
+			rehash(GROUP_WIDTH);
+		else if (_size + 1 > maxLoad(_capacity) / 2)
+			rehash(_capacity * 2);
+		else
+			rehash(_capacity); // Mostly tombstones, clean up in place
+	}
+
+	size_t idx = findFreeIndex(hash);
+	if (_pCtrl[idx] == CTRL_DELETED)
+		_numDeleted--;
+	setCtrl(idx, h2(hash));
+	_size++;
+
+	return idx;
+}
+
+TEMPL_DECL
+void MAP_DECL::eraseIndex(size_t idx)
+{
+	_pSlots[idx].~DataPair();
+	_size--;
+	if (_size == 0) {
+		// Nothing left, drop the tombstones too
+		memset(_pCtrl, CTRL_EMPTY, _capacity + GROUP_WIDTH);
+		_numDeleted = 0;
+	} else {
+		setCtrl(idx, CTRL_DELETED);
+		_numDeleted++;
+	}
+}
+
+TEMPL_DECL
+inline void MAP_DECL::setCtrl(size_t idx, int8_t val)
+{
+	// The first group is mirrored past the end, so a group load never has to wrap around
+	_pCtrl[idx] = val;
+	if (idx < GROUP_WIDTH)
+		_pCtrl[_capacity + idx] = val;
+}
+
+TEMPL_DECL
+void MAP_DECL::allocTable(size_t capacity)
+{
+	static_assert(alignof(DataPair) <= 16, "local_heap blocks are only 16 byte aligned");
+
+	size_t slotBytes = capacity * sizeof(DataPair);
+	_pMem = allocRaw<char>(slotBytes + capacity + GROUP_WIDTH);
+	_pSlots = (DataPair*)_pMem;
+	_pCtrl = (int8_t*)(_pMem + slotBytes);
+	memset(_pCtrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+	_capacity = capacity;
+}
+
+TEMPL_DECL
+void MAP_DECL::rehash(size_t capacity)
+{
+	char* pOldMem = _pMem;
+	DataPair* pOldSlots = _pSlots;
+	int8_t* pOldCtrl = _pCtrl;
+	size_t oldCapacity = _capacity;
+
+	allocTable(capacity);
+	_numDeleted = 0;
+
+	for (size_t i = 0; i < oldCapacity; i++) {
+		if (pOldCtrl[i] >= 0) {
+			size_t hash = hashOf(pOldSlots[i].first);
+			size_t idx = findFreeIndex(hash);
+			setCtrl(idx, h2(hash));
+			new(&_pSlots[idx]) DataPair(std::move(pOldSlots[i]));
+			pOldSlots[i].~DataPair();
+		}
+	}
+
+	if (pOldMem)
+		free(pOldMem);
+}
+
+TEMPL_DECL
+void MAP_DECL::destroyAll()
+{
+	if constexpr (!std::is_trivially_destructible_v<DataPair>) {
+		for (size_t i = 0; i < _capacity; i++) {
+			if (_pCtrl[i] >= 0)
+				_pSlots[i].~DataPair();
+		}
+	}
+}
+
+/*************************************************************************************************/
+/*************************************************************************************************/
+/*************************************************************************************************/
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+ITER_DECL::_iterator(dataMap* pSource, size_t idx)
+	: _pSource(pSource)
+	, _idx(idx)
+{
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+template <int OtherType>
+ITER_DECL::_iterator(const _iterator<OtherType>& src)
+	: _pSource(src._pSource)
+	, _idx(src._idx)
+{
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline bool ITER_DECL::operator == (const _iterator& rhs) const
+{
+	return _idx == rhs._idx;
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline bool ITER_DECL::operator != (const _iterator& rhs) const
+{
+	return _idx != rhs._idx;
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline ITER_DECL& ITER_DECL::operator ++ ()
+{
+	_idx++;
+	skipUnused();
+	return *this;
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline ITER_DECL ITER_DECL::operator ++ (int)
+{
+	_iterator tmp(*this);
+	++*this;
+	return tmp;
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline typename ITER_DECL::reference ITER_DECL::operator *() const
+{
+	return _pSource->_pSlots[_idx];
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline typename ITER_DECL::pointer ITER_DECL::operator->() const
+{
+	return &_pSource->_pSlots[_idx];
+}
+
+TEMPL_DECL
+ITER_TEMPL_DECL
+inline void ITER_DECL::skipUnused()
+{
+	while (_idx < _pSource->_capacity && _pSource->_pCtrl[_idx] < 0)
+		_idx++;
+}
+
+}
+
+#undef TEMPL_DECL
+#undef ITER_TEMPL_DECL
+#undef MAP_DECL
+#undef ITER_DECL
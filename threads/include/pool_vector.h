@@ -35,9 +35,27 @@ This file is part of the DistFieldHexMesh application/library.
 #define REV 3
 #define IS_ITER_CONST (IterType < FORW)
 
+// Capacity is multiplied by this when a vector runs out of room. Must be greater than 1.
+#ifndef POOL_VECTOR_GROWTH_FACTOR
+#define POOL_VECTOR_GROWTH_FACTOR 1.5
+#endif
+
 namespace MultiCore
 {
 
+/*
+	Types which can be moved with memcpy/memmove, leaving the source as raw memory. Default is trivially copyable.
+	Specialize this for types which own resources through pointers and don't point into themselves.
+*/
+template<class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<class T>
+class vector;
+
+template<class T>
+struct is_trivially_relocatable<vector<T>> : std::true_type {};
+
 template<class T>
 class vector : private local_heap_user {
 protected:
@@ -96,6 +114,7 @@ public:
 
 	vector();
 	vector(const MultiCore::vector<T>& src);
+	vector(MultiCore::vector<T>&& src) noexcept;
 	explicit vector(const std::vector<T>& src);
 	vector(const std::initializer_list<T>& src);
 	~vector();
@@ -107,9 +126,13 @@ public:
 	size_t size() const;
 	void resize(size_t val);
 	void reserve(size_t val);
+	size_t capacity() const;
+	void shrink_to_fit();
 
 	iterator insert(const iterator& at, const T& val);
+	iterator insert(const iterator& at, T&& val);
 	const_iterator insert(const const_iterator& at, const T& val);
+	const_iterator insert(const const_iterator& at, T&& val);
 
 	template<class ITER_TYPE>
 	void insert(const iterator& at, const ITER_TYPE& begin, const ITER_TYPE& end);
@@ -120,6 +143,8 @@ public:
 	iterator erase(const iterator& begin, const iterator& end);
 
 	vector& operator = (const MultiCore::vector<T>& rhs);
+	vector& operator = (MultiCore::vector<T>&& rhs) noexcept;
+	void swap(MultiCore::vector<T>& rhs) noexcept;
 //	vector& operator = (const std::vector<T>& rhs);
 
 	const_iterator begin() const noexcept;
@@ -144,9 +169,25 @@ public:
 	T& operator[](size_t idx);
 
 	size_t push_back(const T& val);
+	size_t push_back(T&& val);
+	template<class... ARGS>
+	T& emplace_back(ARGS&&... args);
 	void pop_back();
 
+protected:
+	// Used by small_vector, which keeps its first entries in a buffer right after the vector
+	vector(T* pInline, size_t inlineCapacity);
+	bool isInline() const;
+	void releaseData();
+	void moveToInline(size_t inlineCapacity); // Caller checks the entries fit
+
 private:
+	T* inlineData() const;
+	void grow(size_t minCapacity);
+	void moveElements(T* pDst, T* pSrc, size_t num);
+	void openGap(size_t idx, size_t num);
+	void closeGap(size_t idx, size_t num);
+
 	size_t _size = 0, _capacity = 0;
 	T* _pData = nullptr;
 };
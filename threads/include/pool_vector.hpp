@@ -26,6 +26,10 @@ This file is part of the DistFieldHexMesh application/library.
 	Dark Sky Innovative Solutions http://darkskyinnovation.com/
 */
 
+#include <assert.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include <local_heap.h>
 #include <pool_vector.h>
 
@@ -48,19 +52,52 @@ TEMPL_DECL
 VECTOR_DECL::vector(const vector& src)
 {
 	if (src._size > 0) {
-		resize(src._size);
-		for (size_t i = 0; i < _size; i++)
-			_pData[i] = src._pData[i];
+		reserve(src._size);
+		for (size_t i = 0; i < src._size; i++)
+			new(&_pData[i]) T(src._pData[i]);
+		_size = src._size;
+	}
+}
+
+TEMPL_DECL
+VECTOR_DECL::vector(T* pInline, size_t inlineCapacity)
+{
+	_size = 0;
+	_capacity = inlineCapacity;
+	_pData = pInline;
+}
+
+TEMPL_DECL
+VECTOR_DECL::vector(vector&& src) noexcept
+{
+	if (src.isInline()) {
+		// small_vector storage, it can't be stolen
+		reserve(src._size);
+		moveElements(_pData, src._pData, src._size);
+		_size = src._size;
+		src._size = 0;
+		return;
 	}
+
+	// The storage belongs to src's heap, so we have to use it too.
+	useHeapOf(src);
+	_size = src._size;
+	_capacity = src._capacity;
+	_pData = src._pData;
+
+	src._size = 0;
+	src._capacity = 0;
+	src._pData = nullptr;
 }
 
 TEMPL_DECL
 VECTOR_DECL::vector(const std::vector<T>& src)
 {
 	if (src.size() > 0) {
-		resize(src.size());
-		for (size_t i = 0; i < _size; i++)
-			_pData[i] = src[i];
+		reserve(src.size());
+		for (size_t i = 0; i < src.size(); i++)
+			new(&_pData[i]) T(src[i]);
+		_size = src.size();
 	}
 }
 
@@ -73,8 +110,7 @@ VECTOR_DECL::vector(const std::initializer_list<T>& src)
 TEMPL_DECL
 VECTOR_DECL::~vector()
 {
-	free(_pData); // free<T> will handle destruction for each object in local_heap
-	_pData = nullptr;
+	releaseData();
 }
 
 TEMPL_DECL
@@ -91,12 +127,10 @@ VECTOR_DECL::operator std::vector<T>() const
 TEMPL_DECL
 void VECTOR_DECL::clear()
 {
-	for (size_t i = 0; i < _size; i++) {
-		// Replace with empty objects, but DO NOT destroy them YET.
-		// Use destructor/constructor to get around const members
-		_pData[i].~T();
-		new(&_pData[i]) T();
-//		_pData[i] = T(); 
+	// Keeps the capacity. Free for trivially destructible types.
+	if constexpr (!std::is_trivially_destructible_v<T>) {
+		for (size_t i = 0; i < _size; i++)
+			_pData[i].~T();
 	}
 	_size = 0;
 }
@@ -117,11 +151,15 @@ size_t VECTOR_DECL::size() const
 TEMPL_DECL
 void VECTOR_DECL::resize(size_t val)
 {
-	size_t oldSize = _size;
-	size_t needed = val;
-	if (needed < 8)
-		needed = 8;
-	reserve(needed);
+	if (val > _size) {
+		if (val > _capacity)
+			grow(val);
+		for (size_t i = _size; i < val; i++)
+			new(&_pData[i]) T();
+	} else if constexpr (!std::is_trivially_destructible_v<T>) {
+		for (size_t i = val; i < _size; i++)
+			_pData[i].~T();
+	}
 	_size = val;
 }
 
@@ -129,44 +167,96 @@ TEMPL_DECL
 void VECTOR_DECL::reserve(size_t newCapacity)
 {
 	if (newCapacity > _capacity) {
+		if (_pData && !isInline() && tryExpandRaw(_pData, newCapacity)) {
+			// Grew in place, no copy required
+			_capacity = newCapacity;
+			return;
+		}
+
 		T* pTmp = _pData;
-		_pData = alloc<T>(newCapacity);
+		_pData = allocRaw<T>(newCapacity);
 		if (pTmp) {
-			for (size_t i = 0; i < _size; i++) {
-				_pData[i].~T();
-				new(&_pData[i]) T(pTmp[i]);
-
-				pTmp[i].~T();
-				new(&pTmp[i]) T();
-//				_pData[i] = pTmp[i];
-			}
-
-			free(pTmp);
+			moveElements(_pData, pTmp, _size);
+			if (pTmp != inlineData())
+				free(pTmp);
 		}
 		_capacity = newCapacity;
 	}
 }
 
+TEMPL_DECL
+inline size_t VECTOR_DECL::capacity() const
+{
+	return _capacity;
+}
+
+TEMPL_DECL
+void VECTOR_DECL::shrink_to_fit()
+{
+	if (_capacity == _size || isInline())
+		return;
+
+	T* pTmp = _pData;
+	if (_size > 0) {
+		_pData = allocRaw<T>(_size);
+		moveElements(_pData, pTmp, _size);
+	} else
+		_pData = nullptr;
+
+	free(pTmp);
+	_capacity = _size;
+}
+
+TEMPL_DECL
+void VECTOR_DECL::grow(size_t minCapacity)
+{
+	// Geometric growth keeps repeated push_back/insert amortized O(1)
+	size_t newCapacity = (size_t)(_capacity * POOL_VECTOR_GROWTH_FACTOR);
+	if (newCapacity < minCapacity)
+		newCapacity = minCapacity;
+	if (newCapacity < 8)
+		newCapacity = 8;
+
+	reserve(newCapacity);
+}
+
 TEMPL_DECL
 template<class ITER_TYPE>
 void VECTOR_DECL::insert(const iterator& atIn, const ITER_TYPE& begin, const ITER_TYPE& end)
 {
-	iterator at(atIn);
+	size_t idx = (size_t)(atIn.get() - _pData);
+	size_t num = 0;
+	for (auto iter = begin; iter != end; iter++)
+		num++;
+	if (num == 0)
+		return;
+
+	// Make room once and shift the tail once, instead of once per entry
+	if (_size + num > _capacity)
+		grow(_size + num);
+	openGap(idx, num);
+
 	for (auto iter = begin; iter != end; iter++) {
-		at = insert(at, *iter);
-		at++;
+		new(&_pData[idx]) T(*iter);
+		idx++;
 	}
 }
 
 TEMPL_DECL
 VECTOR_DECL::iterator VECTOR_DECL::insert(const iterator& at, const T& val)
 {
-	size_t idx = (size_t)(at.get() - _pData);
-	resize(_size + 1);
-	for (size_t i = _size - 1; i > idx; i--)
-		_pData[i] = _pData[i - 1];
+	// Copy first, val may be one of our entries and the shift would change it.
+	return insert(at, T(val));
+}
 
-	_pData[idx] = val;
+TEMPL_DECL
+VECTOR_DECL::iterator VECTOR_DECL::insert(const iterator& at, T&& val)
+{
+	size_t idx = (size_t)(at.get() - _pData);
+	if (_size + 1 > _capacity)
+		grow(_size + 1);
+	openGap(idx, 1);
+	new(&_pData[idx]) T(std::move(val));
 
 	return iterator(this, &_pData[idx]);
 }
@@ -174,12 +264,17 @@ VECTOR_DECL::iterator VECTOR_DECL::insert(const iterator& at, const T& val)
 TEMPL_DECL
 VECTOR_DECL::const_iterator VECTOR_DECL::insert(const const_iterator& at, const T& val)
 {
-	size_t idx = (size_t)(at.get() - _pData);
-	resize(_size + 1);
-	for (size_t i = _size - 1; i > idx; i--)
-		_pData[i] = _pData[i - 1];
+	return insert(at, T(val));
+}
 
-	_pData[idx] = val;
+TEMPL_DECL
+VECTOR_DECL::const_iterator VECTOR_DECL::insert(const const_iterator& at, T&& val)
+{
+	size_t idx = (size_t)(at.get() - _pData);
+	if (_size + 1 > _capacity)
+		grow(_size + 1);
+	openGap(idx, 1);
+	new(&_pData[idx]) T(std::move(val));
 
 	return const_iterator(this, &_pData[idx]);
 }
@@ -188,16 +283,17 @@ TEMPL_DECL
 void VECTOR_DECL::insert(const iterator& at, const std::initializer_list<T>& vals)
 {
 	size_t idx = (size_t) (at.get() - _pData);
-	auto begin = vals.begin();
-	auto end = vals.end();
+	size_t entriesNeeded = vals.size();
+	if (entriesNeeded == 0)
+		return;
 
-	size_t entriesNeeded = end - begin;
-	resize(_size + entriesNeeded);
-	for (size_t i = _size - 1; i >= idx + entriesNeeded; i--)
-		_pData[i] = _pData[i - entriesNeeded];
+	if (_size + entriesNeeded > _capacity)
+		grow(_size + entriesNeeded);
+	openGap(idx, entriesNeeded);
 
-	for (auto iter = begin; iter != end; iter++) {
-		_pData[idx++] = *iter;
+	for (const auto& val : vals) {
+		new(&_pData[idx]) T(val);
+		idx++;
 	}
 }
 
@@ -205,12 +301,9 @@ TEMPL_DECL
 VECTOR_DECL::iterator VECTOR_DECL::erase(const iterator& at)
 {
 	size_t idx = (size_t)(at.get() - _pData);
-	if (idx < _size) {
-		for (size_t i = idx; i < _size - 1; i++) {
-			_pData[i] = _pData[i + 1];
-		}
-		_size--;
-	}
+	if (idx < _size)
+		closeGap(idx, 1);
+
 	return iterator(this, at.get());
 }
 
@@ -218,12 +311,9 @@ TEMPL_DECL
 VECTOR_DECL::const_iterator VECTOR_DECL::erase(const const_iterator& at)
 {
 	size_t idx = (size_t)(at.get() - _pData);
-	if (idx < _size) {
-		for (size_t i = idx; i < _size - 1; i++) {
-			_pData[i] = _pData[i + 1];
-		}
-		_size--;
-	}
+	if (idx < _size)
+		closeGap(idx, 1);
+
 	return const_iterator(this, at.get());
 }
 
@@ -232,17 +322,13 @@ VECTOR_DECL::iterator VECTOR_DECL::erase(const iterator& begin, const iterator&
 {
 	size_t startIdx = (size_t)(begin.get() - data());
 	size_t endIdx = (size_t)(end.get() - data());
-	if (startIdx == endIdx)
+	if (endIdx > size())
+		endIdx = size();
+
+	if (startIdx >= endIdx)
 		return begin;
 
-	if (endIdx >= size()) {
-		endIdx = size() - 1;
-	}
-	size_t num = endIdx - startIdx;
-	for (size_t i = startIdx; i < _size - num; i++) {
-		_pData[i] = _pData[i + num];
-	}
-	_size -= num;
+	closeGap(startIdx, endIdx - startIdx);
 
 	return iterator(this, begin._pEntry);
 }
@@ -250,22 +336,77 @@ VECTOR_DECL::iterator VECTOR_DECL::erase(const iterator& begin, const iterator&
 TEMPL_DECL
 MultiCore::vector<T>& VECTOR_DECL::operator = (const MultiCore::vector<T>& rhs)
 {
-	if (_pData) {
-		free(_pData);
-		_pData = nullptr;
+	if (this == &rhs)
+		return *this;
+
+	if (rhs._size <= _capacity) {
+		// Reuse our storage, assign over live entries and construct the rest
+		size_t numLive = _size < rhs._size ? _size : rhs._size;
+		for (size_t i = 0; i < numLive; i++)
+			_pData[i] = rhs._pData[i];
+		for (size_t i = numLive; i < rhs._size; i++)
+			new(&_pData[i]) T(rhs._pData[i]);
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (size_t i = rhs._size; i < _size; i++)
+				_pData[i].~T();
+		}
+		_size = rhs._size;
+
+		return *this;
 	}
+
+	releaseData();
+	_capacity = rhs._size;
+	_pData = allocRaw<T>(_capacity);
+	for (size_t i = 0; i < rhs._size; i++)
+		new(&_pData[i]) T(rhs._pData[i]);
 	_size = rhs._size;
-	_capacity = _size;
 
-	if (_capacity > 0) {
-		_pData = alloc<T>(_capacity);
-		for (size_t i = 0; i < _size; i++)
-			_pData[i] = rhs._pData[i];
+	return *this;
+}
+
+TEMPL_DECL
+MultiCore::vector<T>& VECTOR_DECL::operator = (MultiCore::vector<T>&& rhs) noexcept
+{
+	if (this == &rhs)
+		return *this;
+
+	if (isSameHeap(rhs) && !rhs.isInline()) {
+		releaseData();
+
+		_size = rhs._size;
+		_capacity = rhs._capacity;
+		_pData = rhs._pData;
+
+		rhs._size = 0;
+		rhs._capacity = 0;
+		rhs._pData = nullptr;
+	} else {
+		// The storage can't change heaps or is inside rhs, move the entries instead.
+		clear();
+		reserve(rhs._size);
+		moveElements(_pData, rhs._pData, rhs._size);
+		_size = rhs._size;
+		rhs._size = 0;
 	}
 
 	return *this;
 }
 
+TEMPL_DECL
+void VECTOR_DECL::swap(MultiCore::vector<T>& rhs) noexcept
+{
+	if (isSameHeap(rhs) && !isInline() && !rhs.isInline()) {
+		std::swap(_size, rhs._size);
+		std::swap(_capacity, rhs._capacity);
+		std::swap(_pData, rhs._pData);
+	} else {
+		vector tmp(std::move(rhs));
+		rhs = std::move(*this);
+		*this = std::move(tmp);
+	}
+}
+
 #if 0
 TEMPL_DECL
 MultiCore::vector<T>& VECTOR_DECL::operator = (const std::vector<T>& rhs)
@@ -385,23 +526,33 @@ inline T& VECTOR_DECL::operator[](size_t idx)
 
 TEMPL_DECL
 size_t VECTOR_DECL::push_back(const T& val)
+{
+	emplace_back(val);
+	return _size;
+}
+
+TEMPL_DECL
+size_t VECTOR_DECL::push_back(T&& val)
+{
+	emplace_back(std::move(val));
+	return _size;
+}
+
+TEMPL_DECL
+template<class... ARGS>
+T& VECTOR_DECL::emplace_back(ARGS&&... args)
 {
 	if (_size + 1 > _capacity) {
-		size_t newCapacity = _capacity;
-		if (newCapacity == 0)
-			newCapacity = 8;
-		else
-			newCapacity += newCapacity / 2; // Increase by 25% each time
+		// The args may refer to one of our entries. Build the new entry before the storage moves.
+		T tmp(std::forward<ARGS>(args)...);
 
-		reserve(newCapacity);
+		grow(_size + 1);
+		new(&_pData[_size]) T(std::move(tmp));
+	} else {
+		new(&_pData[_size]) T(std::forward<ARGS>(args)...);
 	}
 
-	_pData[_size].~T();
-	new(&_pData[_size]) T(val);
-//	_pData[_size] = val;
-	_size += 1;
-
-	return _size;
+	return _pData[_size++];
 }
 
 TEMPL_DECL
@@ -409,6 +560,112 @@ void VECTOR_DECL::pop_back()
 {
 //	assert(_size > 0);
 	_size--;
+	_pData[_size].~T();
+}
+
+TEMPL_DECL
+inline T* VECTOR_DECL::inlineData() const
+{
+	// small_vector's buffer starts right after the vector, so comparing against it identifies inline storage without a flag.
+	// Heap data can never be at this address, it's preceded by a block header.
+	constexpr size_t offset = (sizeof(vector) + alignof(T) - 1) / alignof(T) * alignof(T);
+	return (T*)((char*)this + offset);
+}
+
+TEMPL_DECL
+inline bool VECTOR_DECL::isInline() const
+{
+	return _pData == inlineData();
+}
+
+TEMPL_DECL
+void VECTOR_DECL::moveToInline(size_t inlineCapacity)
+{
+	assert(_size <= inlineCapacity);
+	if (isInline())
+		return;
+
+	T* pTmp = _pData;
+	_pData = inlineData();
+	moveElements(_pData, pTmp, _size);
+	if (pTmp)
+		free(pTmp);
+	_capacity = inlineCapacity;
+}
+
+TEMPL_DECL
+void VECTOR_DECL::releaseData()
+{
+	clear();
+	if (_pData && !isInline())
+		free(_pData); // Raw storage, free doesn't destroy anything
+
+	_pData = nullptr;
+	_capacity = 0;
+}
+
+/*
+	Only entries [0, _size) are constructed, the rest of the capacity is raw memory.
+	Trivially relocatable entries are moved with memcpy/memmove, the source is left as raw memory.
+*/
+TEMPL_DECL
+void VECTOR_DECL::moveElements(T* pDst, T* pSrc, size_t num)
+{
+	// pDst is raw, pSrc is raw after the move
+	if constexpr (is_trivially_relocatable<T>::value) {
+		if (num > 0)
+			memcpy((void*)pDst, (const void*)pSrc, num * sizeof(T));
+	} else {
+		for (size_t i = 0; i < num; i++) {
+			new(&pDst[i]) T(std::move(pSrc[i]));
+			pSrc[i].~T();
+		}
+	}
+}
+
+TEMPL_DECL
+void VECTOR_DECL::openGap(size_t idx, size_t num)
+{
+	// Caller must reserve _size + num first. The gap is left as raw memory for the caller to construct.
+	if constexpr (is_trivially_relocatable<T>::value) {
+		size_t numToShift = _size - idx;
+		if (numToShift > 0)
+			memmove((void*)&_pData[idx + num], (const void*)&_pData[idx], numToShift * sizeof(T));
+	} else {
+		// Back to front, each destination is either past the end or an entry which has already been moved
+		for (size_t i = _size; i-- > idx; ) {
+			new(&_pData[i + num]) T(std::move(_pData[i]));
+			_pData[i].~T();
+		}
+	}
+	_size += num;
+}
+
+TEMPL_DECL
+void VECTOR_DECL::closeGap(size_t idx, size_t num)
+{
+	if constexpr (!std::is_trivially_destructible_v<T>) {
+		for (size_t i = idx; i < idx + num; i++)
+			_pData[i].~T();
+	}
+
+	if constexpr (is_trivially_relocatable<T>::value) {
+		size_t numToShift = _size - (idx + num);
+		if (numToShift > 0)
+			memmove((void*)&_pData[idx], (const void*)&_pData[idx + num], numToShift * sizeof(T));
+	} else {
+		for (size_t i = idx + num; i < _size; i++) {
+			new(&_pData[i - num]) T(std::move(_pData[i]));
+			_pData[i].~T();
+		}
+	}
+	_size -= num;
+}
+
+template<class T>
+inline void swap(vector<T>& lhs, vector<T>& rhs) noexcept
+{
+	lhs.swap(rhs);
 }
 
 /*************************************************************************************************/
@@ -51,6 +51,11 @@
 #endif
 
 #include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <istream>
+#include <ostream>
 #include <MultiCoreUtil.h>
 
 #if defined(_WIN32)
@@ -146,6 +151,15 @@ void ThreadPool::runFunc_private(size_t numSteps, FuncType* f) const
 
 		_numSteps = numSteps;
 		_pFunc = f;
+		_useThreadIndices = buildThreadIndices(numSteps);
+		_recordRun = _recording;
+		if (_recordRun) {
+			_threadSteps.resize(_numThreads);
+			for (auto& steps : _threadSteps)
+				steps.clear();
+		}
+		_runCount++;
+		_runStart = chrono::steady_clock::now();
 		setStageForAll(AT_RUNNING);
 	}
 
@@ -155,6 +169,9 @@ void ThreadPool::runFunc_private(size_t numSteps, FuncType* f) const
 			return atStage(AT_STOPPED);
 			});
 
+		if (_recordRun)
+			finishRecording(numSteps);
+
 		_numSteps = 0;
 		_pFunc = nullptr;
 
@@ -180,10 +197,8 @@ void ThreadPool::run(size_t threadNum) {
 			});
 		}
 
-		if (_pFunc) {
-			for (size_t i = threadNum; i < _numSteps; i += _numThreads)
-				(*_pFunc)(threadNum, i);
-		}
+		if (_pFunc)
+			runSteps(threadNum);
 
 		{
 			_STD unique_lock lk(_stageMutex);
@@ -193,3 +208,156 @@ void ThreadPool::run(size_t threadNum) {
 	_STD unique_lock lk(_stageMutex);
 	setStage(AT_TERMINATED, threadNum);
 }
+
+void ThreadPool::runSteps(size_t threadNum)
+{
+	// In worker thread
+	auto runStep = [this, threadNum](size_t idx) {
+		if (_recordRun) {
+			auto start = chrono::steady_clock::now();
+			(*_pFunc)(threadNum, idx);
+			auto stop = chrono::steady_clock::now();
+
+			ScheduleStep step;
+			step._threadNum = threadNum;
+			step._idx = idx;
+			step._startNs = chrono::duration_cast<chrono::nanoseconds>(start - _runStart).count();
+			step._stopNs = chrono::duration_cast<chrono::nanoseconds>(stop - _runStart).count();
+			_threadSteps[threadNum].push_back(step);
+		} else
+			(*_pFunc)(threadNum, idx);
+	};
+
+	if (_useThreadIndices) {
+		for (size_t idx : _threadIndices[threadNum])
+			runStep(idx);
+	} else {
+		for (size_t idx = threadNum; idx < _numSteps; idx += _numThreads)
+			runStep(idx);
+	}
+}
+
+void ThreadPool::setScheduleMode(ScheduleMode mode, uint64_t seed)
+{
+	_scheduleMode = mode;
+	_seed = seed;
+	_runCount = 0;
+}
+
+ScheduleMode ThreadPool::getScheduleMode() const
+{
+	return _scheduleMode;
+}
+
+void ThreadPool::setReplaySchedules(const vector<Schedule>& schedules)
+{
+	_replaySchedules = schedules;
+	_runCount = 0;
+}
+
+void ThreadPool::setRecording(bool record)
+{
+	_recording = record;
+}
+
+const vector<Schedule>& ThreadPool::getRecordedSchedules() const
+{
+	return _recordedSchedules;
+}
+
+void ThreadPool::clearRecordedSchedules()
+{
+	_recordedSchedules.clear();
+}
+
+bool ThreadPool::buildThreadIndices(size_t numSteps) const
+{
+	// In primary thread, workers are stopped
+	_threadIndices.resize(_numThreads);
+	for (auto& indices : _threadIndices)
+		indices.clear();
+
+	switch (_scheduleMode) {
+	case SCHEDULE_SHUFFLE: {
+		vector<size_t> order(numSteps);
+		iota(order.begin(), order.end(), 0);
+		mt19937_64 rng(_seed + _runCount);
+		shuffle(order.begin(), order.end(), rng);
+
+		for (size_t i = 0; i < numSteps; i++)
+			_threadIndices[i % _numThreads].push_back(order[i]);
+		return true;
+	}
+	case SCHEDULE_REPLAY: {
+		if (_runCount >= _replaySchedules.size())
+			return false;
+
+		// Steps are in start time order, so each thread's indices stay in the order it ran them
+		const auto& schedule = _replaySchedules[_runCount];
+		bool matches = schedule._numSteps == numSteps && schedule._numThreads == _numThreads && schedule._steps.size() == numSteps;
+		vector<bool> seen(numSteps, false);
+		for (size_t i = 0; matches && i < schedule._steps.size(); i++) {
+			const auto& step = schedule._steps[i];
+			matches = step._threadNum < _numThreads && step._idx < numSteps && !seen[step._idx];
+			if (matches) {
+				seen[step._idx] = true;
+				_threadIndices[step._threadNum].push_back(step._idx);
+			}
+		}
+
+		// A schedule recorded with a different thread count or step count falls back to strided, as documented
+		return matches;
+	}
+	default:
+		return false;
+	}
+}
+
+void ThreadPool::finishRecording(size_t numSteps) const
+{
+	// In primary thread, workers are stopped
+	Schedule schedule;
+	schedule._numSteps = numSteps;
+	schedule._numThreads = _numThreads;
+	schedule._steps.reserve(numSteps);
+	for (const auto& steps : _threadSteps)
+		schedule._steps.insert(schedule._steps.end(), steps.begin(), steps.end());
+
+	stable_sort(schedule._steps.begin(), schedule._steps.end(), [](const ScheduleStep& lhs, const ScheduleStep& rhs) {
+		return lhs._startNs < rhs._startNs;
+	});
+
+	_recordedSchedules.push_back(move(schedule));
+}
+
+void MultiCore::writeSchedules(ostream& out, const vector<Schedule>& schedules)
+{
+	for (const auto& schedule : schedules) {
+		out << "run " << schedule._numSteps << " " << schedule._numThreads << " " << schedule._steps.size() << "\n";
+		for (const auto& step : schedule._steps)
+			out << step._threadNum << " " << step._idx << " " << step._startNs << " " << step._stopNs << "\n";
+	}
+}
+
+bool MultiCore::readSchedules(istream& in, vector<Schedule>& schedules)
+{
+	schedules.clear();
+
+	string tag;
+	while (in >> tag) {
+		size_t numEntries;
+		Schedule schedule;
+		if (tag != "run" || !(in >> schedule._numSteps >> schedule._numThreads >> numEntries))
+			return false;
+
+		schedule._steps.resize(numEntries);
+		for (auto& step : schedule._steps) {
+			if (!(in >> step._threadNum >> step._idx >> step._startNs >> step._stopNs))
+				return false;
+		}
+
+		schedules.push_back(move(schedule));
+	}
+
+	return in.eof();
+}
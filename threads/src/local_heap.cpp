@@ -106,14 +106,14 @@ void* ::MultiCore::local_heap::allocMem(size_t numBytes)
 	if (_topBlockIdx >= _data.size() || (_topChunkIdx + numChunks >= blockChunks)) {
 		// Not enough room in the block, so make an empty one.
 
-		if (_topChunkIdx + numChunks >= _blockSizeChunks) {
-			// Store the empty space for the next allocation
+		if (_topBlockIdx < _data.size() && _topChunkIdx < getBlockSizeChunks(_topBlockIdx)) {
+			// Store the empty space for the next allocation.
+			// Use the real size of the top block, oversized blocks are larger than _blockSizeChunks
 			BlockHeader headerForRemainder;
 			headerForRemainder._blockIdx = _topBlockIdx;
 			headerForRemainder._chunkIdx = (uint32_t) _topChunkIdx;
-			headerForRemainder._numChunks = (uint32_t) (_blockSizeChunks - _topChunkIdx);
-			if (headerForRemainder._numChunks > 0)
-				addBlockToAvailList(headerForRemainder);
+			headerForRemainder._numChunks = (uint32_t) (getBlockSizeChunks(_topBlockIdx) - _topChunkIdx);
+			addBlockToAvailList(headerForRemainder);
 			createdNewBlock = true;
 		}
 
@@ -155,6 +155,73 @@ void* ::MultiCore::local_heap::allocMem(size_t numBytes)
 	return pStartData;
 }
 
+bool ::MultiCore::local_heap::expandMem(void* ptr, size_t numBytes)
+{
+	char* pc = (char*)ptr - sizeof(BlockHeader);
+	BlockHeader* pHeader = (BlockHeader*)pc;
+
+#if GUARD_BAND_SIZE > 0
+	size_t bytesNeeded = numBytes + sizeof(BlockHeader) + sizeof(GuardBand);
+#else
+	size_t bytesNeeded = numBytes + sizeof(BlockHeader);
+#endif
+	size_t numChunks = bytesNeeded / _chunkSizeBytes;
+	if (bytesNeeded % _chunkSizeBytes != 0)
+		numChunks++;
+
+	if (numChunks > pHeader->_numChunks) {
+		size_t extraChunks = numChunks - pHeader->_numChunks;
+		size_t endChunkIdx = pHeader->_chunkIdx + pHeader->_numChunks;
+		size_t blockChunks = getBlockSizeChunks(pHeader->_blockIdx);
+
+		if (pHeader->_blockIdx == _topBlockIdx && endChunkIdx == _topChunkIdx) {
+			// This is the last block carved from the top block. Grow it into the unused space.
+			// Same rule as allocMem, the top block is never filled to the last chunk.
+			if (_topChunkIdx + extraChunks >= blockChunks)
+				return false;
+
+			_topChunkIdx += (uint32_t)extraChunks;
+		} else {
+			// Chunks are tiled by headers up to the top of the block, so the next header is either allocated or avail.
+			size_t usedChunks = (pHeader->_blockIdx == _topBlockIdx) ? _topChunkIdx : blockChunks;
+			if (endChunkIdx >= usedChunks)
+				return false;
+
+			auto& blkVec = *_data[pHeader->_blockIdx];
+			AvailBlockHeader* pNextBlock = (AvailBlockHeader*)&blkVec[endChunkIdx * _chunkSizeBytes];
+			BlockHeader nextHeader = pNextBlock->_header;
+			if (nextHeader._numChunks < extraChunks || !removeIfAvail(pNextBlock))
+				return false;
+
+			if (nextHeader._numChunks > extraChunks) {
+				// Return the unused tail of the neighbor
+				BlockHeader headerForRemainder;
+				headerForRemainder._blockIdx = nextHeader._blockIdx;
+				headerForRemainder._chunkIdx = (uint32_t)(endChunkIdx + extraChunks);
+				headerForRemainder._numChunks = (uint32_t)(nextHeader._numChunks - extraChunks);
+				addBlockToAvailList(headerForRemainder);
+			}
+		}
+
+		pHeader->_numChunks += (uint32_t)extraChunks;
+	}
+
+#if GUARD_BAND_SIZE > 0
+	char* pStartData = (char*)ptr;
+	GuardBand* pTail = (GuardBand*)(pStartData + numBytes);
+	new(pTail) GuardBand();
+	pHeader->_leadingBand._pEndBand = pTail;
+	assert(pHeader->_leadingBand.isValid());
+#endif
+
+	return true;
+}
+
+size_t ::MultiCore::local_heap::getBlockSizeChunks(size_t blockIdx) const
+{
+	return _data[blockIdx]->size() / _chunkSizeBytes;
+}
+
 bool ::MultiCore::local_heap::verify() const
 {
 	return verifyAvailList();
@@ -296,6 +363,24 @@ void ::MultiCore::local_heap::removeAvailBlock(AvailBlockHeader*& pFirstAvailBlo
 	}
 }
 
+bool ::MultiCore::local_heap::removeIfAvail(AvailBlockHeader* pBlock)
+{
+	AvailBlockHeader*& pFirstAvailBlock = getFirstAvailBlockPtr(pBlock->_header._numChunks);
+	AvailBlockHeader* pCurBlock = pFirstAvailBlock;
+	AvailBlockHeader* pPriorBlock = pFirstAvailBlock;
+
+	while (pCurBlock) {
+		if (pCurBlock == pBlock) {
+			removeAvailBlock(pFirstAvailBlock, pPriorBlock, pCurBlock);
+			return true;
+		}
+		pPriorBlock = pCurBlock;
+		pCurBlock = pCurBlock->_pNext;
+	}
+
+	return false;
+}
+
 bool ::MultiCore::local_heap::isHeaderValid(const void* p, bool pointsToHeader) const
 {
 	const char* pc = (const char*) p;
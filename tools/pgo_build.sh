@@ -0,0 +1,95 @@
+#!/usr/bin/env bash
+#
+# Profile guided optimization build of the threads and opengl libraries.
+#
+#   tools/pgo_build.sh [build root] [extra cmake args...]
+#
+# 1. Builds a baseline (UTIL_PGO=OFF) and records the benchmarks
+# 2. Builds instrumented (UTIL_PGO=GENERATE) and runs the training workloads, threads_bench for the ThreadPool,
+#    local_heap and container paths and ogl_bench for the MultiVboHandler tessellate and draw replay
+# 3. Rebuilds the same tree with the profile (UTIL_PGO=USE), records the benchmarks and reports the speedup of each
+#
+# gcc keys its profile files on the object paths, so the USE build must reuse the GENERATE build directory.
+# ogl_bench needs EGL, on a headless box Mesa's llvmpipe is used. It's skipped if it wasn't built.
+
+set -euo pipefail
+
+srcDir="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+buildRoot="${1:-${srcDir}/build-pgo}"
+shift || true
+extraArgs=("$@")
+
+baselineDir="${buildRoot}/baseline"
+pgoDir="${buildRoot}/pgo"
+profileDir="${pgoDir}/pgo-profile"
+resultsDir="${buildRoot}/results"
+jobs="$(nproc 2>/dev/null || echo 4)"
+
+configure() {
+	local dir="$1" stage="$2"
+	cmake -S "${srcDir}" -B "${dir}" -DCMAKE_BUILD_TYPE=Release -DUTIL_PGO="${stage}" -DUTIL_PGO_DIR="${profileDir}" \
+		"${extraArgs[@]}" > "${dir}.configure.log"
+}
+
+build() {
+	cmake --build "$1" -j"${jobs}" > "$1.build.log"
+}
+
+# Runs each benchmark that was built, writing NAME.csv into $2. Remaining args go to the benchmarks.
+runBenches() {
+	local dir="$1" outDir="$2"
+	shift 2
+	mkdir -p "${outDir}"
+	for bench in threads/threads_bench opengl/ogl_bench; do
+		local exe="${dir}/${bench}"
+		if [[ -x "${exe}" ]]; then
+			echo "  $(basename "${exe}")"
+			"${exe}" "$@" --format csv --out "${outDir}/$(basename "${exe}").csv" 2> /dev/null
+		fi
+	done
+}
+
+isClang() {
+	grep -q "CMAKE_CXX_COMPILER_ID:.*Clang" "$1/CMakeCache.txt" 2> /dev/null ||
+		"$(grep "^CMAKE_CXX_COMPILER:" "$1/CMakeCache.txt" | cut -d= -f2)" --version | grep -q clang
+}
+
+mkdir -p "${buildRoot}" "${resultsDir}"
+
+echo "Baseline build"
+configure "${baselineDir}" OFF
+build "${baselineDir}"
+runBenches "${baselineDir}" "${resultsDir}/baseline"
+
+echo "Instrumented build"
+rm -rf "${profileDir}"
+mkdir -p "${profileDir}"
+configure "${pgoDir}" GENERATE
+build "${pgoDir}"
+
+echo "Training"
+runBenches "${pgoDir}" "${resultsDir}/training" --quick --reps 1
+
+if isClang "${pgoDir}"; then
+	llvm-profdata merge -output="${profileDir}/default.profdata" "${profileDir}"/*.profraw
+fi
+
+echo "Optimized build"
+configure "${pgoDir}" USE
+build "${pgoDir}"
+runBenches "${pgoDir}" "${resultsDir}/pgo"
+
+echo
+echo "Speedup, baseline ns/op divided by PGO ns/op"
+for csv in "${resultsDir}"/baseline/*.csv; do
+	name="$(basename "${csv}")"
+	[[ -f "${resultsDir}/pgo/${name}" ]] || continue
+	awk -F, '
+		FNR == 1 { next }
+		NR == FNR { base[$1 "/" $2 "/" $3 "/" $4] = $6; next }
+		{
+			key = $1 "/" $2 "/" $3 "/" $4
+			if (key in base && $6 > 0)
+				printf "%-56s %14.1f %14.1f %8.2fx\n", key, base[key], $6, base[key] / $6
+		}' "${csv}" "${resultsDir}/pgo/${name}"
+done | sort | awk 'BEGIN { printf "%-56s %14s %14s %9s\n", "benchmark", "baseline", "pgo", "speedup" } { print }'